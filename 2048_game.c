@@ -5,9 +5,10 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include "input.h" // Contains Keypad_Get_Key
-#include "Swipe_check.h" // Contains Swipe_Dir_t and Touch_Update_Swipe
+#include "game_input.h" // Keypad + swipe -> logical actions
 #include "sound.h"
+#include "music.h"
+#include "compositor.h"
 /************************************************************
  * 2048 GAME ENGINE
  ************************************************************/
@@ -15,6 +16,8 @@
 #define GRID_SIZE       4
 #define CELL_PADDING    4
 #define GAME_SPEED_MS   50 // Delay between rendering frames
+#define BOARD_BK_COLOR  0x00444444
+#define SCORE_STRIP_H   28 // Header band holding the score line
 
 /* UI Dimensions */
 static int BOX_SIZE; 
@@ -23,12 +26,39 @@ static int OFFSET_Y;
 
 typedef enum { DIR_UP, DIR_DOWN, DIR_LEFT, DIR_RIGHT } dir_t;
 
+/* Keys and swipes both move the board; taps, holds and drags don't */
+static const Input_KeyBind_t g2048_keys[] = {
+    {'2', INPUT_UP,      0},
+    {'8', INPUT_DOWN,    0},
+    {'4', INPUT_LEFT,    0},
+    {'6', INPUT_RIGHT,   0},
+    {'D', INPUT_RESTART, 0},
+    {'#', INPUT_EXIT,    0}
+};
+
+static const Input_Map_t g2048_map = {
+    .keys     = g2048_keys,
+    .num_keys = sizeof(g2048_keys) / sizeof(g2048_keys[0]),
+    .gesture  = {
+        [SWIPE_UP]    = INPUT_UP,
+        [SWIPE_DOWN]  = INPUT_DOWN,
+        [SWIPE_LEFT]  = INPUT_LEFT,
+        [SWIPE_RIGHT] = INPUT_RIGHT
+    }
+};
+
 /*********** GLOBAL GAME STATE ***********/
 static int board[GRID_SIZE][GRID_SIZE];
 static int score;
 static int game_over;
 static int victory; 
 
+/*********** RENDER STATE ***********/
+// Last values put on the panel: a move repaints only what differs
+static int drawn_board[GRID_SIZE][GRID_SIZE];
+static int drawn_score;
+static int scene_valid;     // 0 = next draw_scene repaints everything
+
 /*********** INTERNAL PROTOTYPES ***********/
 static void init_game(void);
 static void draw_scene(void);
@@ -48,9 +78,6 @@ static int  slide_and_merge_left(void);
 void Start2048Game(void)
 {
     GUI_Clear();
-    
-    // Debounce State Variable (only for Keypad)
-    static char last_key = 0;
 
     // Dynamic Layout Calculation (Unchanged)
     int scr_w = LCD_GetXSize();
@@ -65,92 +92,48 @@ void Start2048Game(void)
     OFFSET_Y = (scr_h - (BOX_SIZE * GRID_SIZE)) / 2 + 10; 
 
     init_game();
+    Music_Play(&song_2048);
+    Input_Begin(&g2048_map);        // Don't inherit the menu key or tap
     // INITIAL RENDER: Must draw the initial board state with 2 tiles
     draw_scene(); 
 
     while (1)
     {
+        Input_Action_t act;
+        int needs_render = 0;
+
         /* ------------------------------
-         * ASYNCHRONOUS INPUT CONTROL
+         * INPUT: every queued move is applied in order
          * ------------------------------ */
-        Swipe_Dir_t swipe_dir = Touch_Update_Swipe(); // Non-blocking check for touch swipe
-        char current_key = Keypad_Get_Key();          // Non-blocking check for keypad press
-        
-        int moved = 0;
-        dir_t board_move_dir = DIR_UP; // Default, will be overwritten
-        int input_detected = 0;
-        int needs_render = 0; // NEW FLAG: To control when rendering occurs
-
-        // 1. DETERMINE MOVEMENT DIRECTION (Swipe takes priority)
-        if (swipe_dir != SWIPE_NONE) {
-            input_detected = 1;
-            switch(swipe_dir) {
-                case SWIPE_UP: board_move_dir = DIR_UP; break;
-                case SWIPE_DOWN: board_move_dir = DIR_DOWN; break;
-                case SWIPE_LEFT: board_move_dir = DIR_LEFT; break;
-                case SWIPE_RIGHT: board_move_dir = DIR_RIGHT; break;
-                case SWIPE_NONE: break; 
-            }
-        }
-        // 2. CHECK KEYPAD (Only if no swipe was detected AND it's a new key press)
-        else if (current_key != 0 && current_key != last_key) {
-            
-            // Check for game movement keys
-            if (current_key == '2') { board_move_dir = DIR_UP; input_detected = 1; }
-            else if (current_key == '8') { board_move_dir = DIR_DOWN; input_detected = 1; }
-            else if (current_key == '4') { board_move_dir = DIR_LEFT; input_detected = 1; }
-            else if (current_key == '6') { board_move_dir = DIR_RIGHT; input_detected = 1; }
-            
-            // Check for system keys
-            if (current_key == '#') { last_key = current_key; return; } // Exit
-            if (current_key == 'D') { // Restart
-                init_game();
-                osDelay(200);
-                last_key = current_key;
-                needs_render = 1; // Needs a render after re-initialization
-                
-                // Jump to rendering/delay section
-                goto RENDER_AND_WAIT;
+        Input_Poll();
+        while (!game_over && Input_Get(&act))
+        {
+            dir_t board_move_dir;
+
+            switch (act) {
+                case INPUT_UP:    board_move_dir = DIR_UP;    break;
+                case INPUT_DOWN:  board_move_dir = DIR_DOWN;  break;
+                case INPUT_LEFT:  board_move_dir = DIR_LEFT;  break;
+                case INPUT_RIGHT: board_move_dir = DIR_RIGHT; break;
+                case INPUT_EXIT:  return;
+                case INPUT_RESTART:
+                    init_game();
+                    needs_render = 1;
+                    continue;
+                default: continue;
             }
-        }
 
-        /* ------------------------------
-         * EXECUTE GAME LOGIC (ONLY IF MOVE INPUT DETECTED)
-         * ------------------------------ */
-        if (input_detected && !game_over) {
-            
-            // A. Execute Game Move
-            if (board_move_dir == DIR_UP || board_move_dir == DIR_DOWN || board_move_dir == DIR_LEFT || board_move_dir == DIR_RIGHT)
-            {
-                moved = move_board(board_move_dir);
-                
-                // B. REGENERATE/UPDATE GAME ONLY IF A TILE MOVED/MERGED
-                if (moved) {
-                    spawn_tile();
-                    needs_render = 1; // Board changed, needs render
-                    
-                    if (!can_move()) {
-                        game_over = 1;
-                        needs_render = 1; // Game over state needs to be drawn
-                    }
-                }
-                
-                // If a valid move input was received but no tile moved (e.g., board is full in that direction), 
-                // we still need a delay before the next input can be processed.
-                if (input_detected) {
-                    osDelay(GAME_SPEED_MS);
-                }
+            // Only a move that shifted or merged something spawns a tile
+            if (move_board(board_move_dir)) {
+                spawn_tile();
+                needs_render = 1;
+                if (!can_move()) game_over = 1;
             }
         }
-        
-        // Update history for next frame (Crucial for keypad debouncing/single press)
-        last_key = current_key;
 
         /* ------------------------------
-         * RENDER (Controlled by needs_render flag)
+         * RENDER (only when the board changed)
          * ------------------------------ */
-        RENDER_AND_WAIT: // Label for 'D' key restart jump
-        
         if (needs_render) {
             draw_scene();
         }
@@ -158,29 +141,24 @@ void Start2048Game(void)
         if (game_over) {
             Sound_GameOverBeep();  
             draw_game_over();
+            scene_valid = 0;    // The box covers the middle tiles
             
-            // Wait loop for Game Over screen (requires physical key input)
+            // Wait for a fresh restart or exit
+            Input_Flush();
             while (1) {
-                char k = Keypad_Get_Key();
-                
-                if (k == 'D') {
-                    init_game();
-                    osDelay(200);
-                    draw_scene(); // Draw the new initial board
-                    break;
+                Input_Poll();
+                if (Input_Get(&act)) {
+                    if (act == INPUT_EXIT) return;
+                    if (act == INPUT_RESTART) break;
+                    continue;
                 }
-                
-                if (k == '#') return;
-                
                 osDelay(50);
             }
+            init_game();
+            draw_scene(); // Draw the new initial board
         }
         else {
-            // Delay to maintain frame rate / reduce CPU load, but only if we didn't just move/restart
-            // The `if (input_detected)` block above already handled a move delay, so this is for idle time.
-            if (!needs_render) {
-                 osDelay(GAME_SPEED_MS); 
-            }
+            osDelay(GAME_SPEED_MS);
         }
     }
 }
@@ -194,6 +172,7 @@ static void init_game(void)
     score = 0;
     game_over = 0;
     victory = 0;
+    scene_valid = 0;
 
     // Clear Board
     for (int r = 0; r < GRID_SIZE; r++) {
@@ -359,55 +338,88 @@ static GUI_COLOR get_tile_color(int val)
     }
 }
 
-static void draw_scene(void)
+static void draw_score(void)
 {
-    GUI_SetBkColor(0x00444444); 
-    GUI_Clear();
+    char score_buf[32];
 
-    /* Draw Header */
+    GUI_SetBkColor(BOARD_BK_COLOR);
+    GUI_ClearRect(0, 0, LCD_GetXSize() - 1, SCORE_STRIP_H - 1);
     GUI_SetColor(GUI_WHITE);
     GUI_SetFont(GUI_FONT_20_ASCII);
-    char score_buf[32];
     sprintf(score_buf, "SCORE: %d", score);
     GUI_DispStringHCenterAt(score_buf, LCD_GetXSize() / 2, 5);
+    drawn_score = score;
+}
+
+static void draw_tile(int r, int c)
+{
+    int val = board[r][c];
+    int x0 = OFFSET_X + (c * BOX_SIZE) + CELL_PADDING;
+    int y0 = OFFSET_Y + (r * BOX_SIZE) + CELL_PADDING;
+    int x1 = x0 + BOX_SIZE - (CELL_PADDING * 2);
+    int y1 = y0 + BOX_SIZE - (CELL_PADDING * 2);
+
+    // Draw Tile Background
+    GUI_SetColor(get_tile_color(val));
+    GUI_FillRect(x0, y0, x1, y1);
+
+    // Draw Number
+   if (val > 0) {
+        // Force White color for numbers for contrast
+        GUI_SetColor(GUI_WHITE);      
+        
+        // Adjust font size based on number length
+        if (val < 100) GUI_SetFont(GUI_FONT_32B_ASCII);
+        else if (val < 1000) GUI_SetFont(GUI_FONT_24B_ASCII);
+        else GUI_SetFont(GUI_FONT_20_ASCII);
+
+        char num_buf[8];
+        sprintf(num_buf, "%d", val);
+        
+        // Calculate centering
+        int tx_size = GUI_GetStringDistX(num_buf);
+        int ty_size = GUI_GetFontSizeY();
+        
+        int tx = x0 + ((x1 - x0) - tx_size) / 2;
+        int ty = y0 + ((y1 - y0) - ty_size) / 2;
+        
+        GUI_DispStringAt(num_buf, tx, ty);
+    }
+
+    drawn_board[r][c] = val;
+}
+
+static void draw_full_cb(void *p)
+{
+    (void)p;
+    GUI_SetBkColor(BOARD_BK_COLOR); 
+    GUI_Clear();
+    draw_score();
+    for (int r = 0; r < GRID_SIZE; r++)
+        for (int c = 0; c < GRID_SIZE; c++)
+            draw_tile(r, c);
+}
+
+/* Full frame (banded, see compositor.c) after init, restarts and the game
+   over box; otherwise only the tiles whose value changed, and the score
+   strip when it moved */
+static void draw_scene(void)
+{
+    GUI_SetBkColor(BOARD_BK_COLOR); 
+
+    if (!scene_valid) {
+        Compositor_Draw(NULL, draw_full_cb, NULL);
+        scene_valid = 1;
+        return;
+    }
+
+    if (score != drawn_score) draw_score();
 
-    /* Draw Grid */
     for (int r = 0; r < GRID_SIZE; r++)
     {
         for (int c = 0; c < GRID_SIZE; c++)
         {
-            int val = board[r][c];
-            int x0 = OFFSET_X + (c * BOX_SIZE) + CELL_PADDING;
-            int y0 = OFFSET_Y + (r * BOX_SIZE) + CELL_PADDING;
-            int x1 = x0 + BOX_SIZE - (CELL_PADDING * 2);
-            int y1 = y0 + BOX_SIZE - (CELL_PADDING * 2);
-
-            // Draw Tile Background
-            GUI_SetColor(get_tile_color(val));
-            GUI_FillRect(x0, y0, x1, y1);
-
-            // Draw Number
-           if (val > 0) {
-                // Force White color for numbers for contrast
-                GUI_SetColor(GUI_WHITE);      
-                
-                // Adjust font size based on number length
-                if (val < 100) GUI_SetFont(GUI_FONT_32B_ASCII);
-                else if (val < 1000) GUI_SetFont(GUI_FONT_24B_ASCII);
-                else GUI_SetFont(GUI_FONT_20_ASCII);
-
-                char num_buf[8];
-                sprintf(num_buf, "%d", val);
-                
-                // Calculate centering
-                int tx_size = GUI_GetStringDistX(num_buf);
-                int ty_size = GUI_GetFontSizeY();
-                
-                int tx = x0 + ((x1 - x0) - tx_size) / 2;
-                int ty = y0 + ((y1 - y0) - ty_size) / 2;
-                
-                GUI_DispStringAt(num_buf, tx, ty);
-            }
+            if (board[r][c] != drawn_board[r][c]) draw_tile(r, c);
         }
     }
 }
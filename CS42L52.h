@@ -12,5 +12,18 @@
 #define CS42L52_BEEP_FREQ       0x1C
 #define CS42L52_BEEP_VOL        0x1D
 #define CS42L52_BEEP_TONE_CTL   0x1E
+#define CS42L52_REG_LAST        0x34    // Highest register address
+
+/* MAP byte: set bit 7 to auto-increment through consecutive registers */
+#define CS42L52_MAP_INCR        0x80
+
+/* CHIP_ID register: CHIPID[7:3] identifies the part, REVID[2:0] the revision */
+#define CS42L52_CHIP_ID_MASK    0xF8
+#define CS42L52_CHIP_ID_VAL     0xE0
+
+#include <stdint.h>
+
+int  Codec_Init(void);
+void Codec_Beep(uint8_t pitch, uint8_t duration);
 
 #endif
\ No newline at end of file
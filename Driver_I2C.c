@@ -1,23 +1,83 @@
 #include "Driver_I2C.h"
 #include "stm32f4xx.h"
+#include "stm32f4xx_hal.h"
+#include <string.h>
 
 /* =========================================
    1. CONFIG / CONSTANTS
    ========================================= */
 
-#define I2C_TIMEOUT      (100000U)
-// APB1 Clock assumption: 42 MHz
-#define I2C_PCLK1_MHZ    42U
-#define I2C_CCR_SM_100K  210U
-#define I2C_TRISE_SM     43U
+// SCL targets (the F4 I2C cell tops out at Fast-mode, RM0090 27.3.3)
+#define I2C_SM_HZ        100000U
+#define I2C_FM_HZ        400000U
+
+// Maximum SCL rise time in ns: Sm 1000 ns, Fm 300 ns
+#define I2C_TRISE_SM_NS  1000U
+#define I2C_TRISE_FM_NS  300U
+
+// Transfers of at least this many bytes are moved by DMA, shorter ones by
+// the event/buffer IRQ. DMA receive needs >= 2 bytes for the LAST/NACK logic.
+#define I2C_DMA_MIN_BYTES  2U
+
+// DMA1 mapping for I2C1 (RM0090 Table 42): RX = Stream0/Ch1, TX = Stream6/Ch1
+#define I2C_DMA_RX         DMA1_Stream0
+#define I2C_DMA_TX         DMA1_Stream6
+#define I2C_DMA_CHANNEL    (1U << DMA_SxCR_CHSEL_Pos)
+
+// Upper bound for waiting on a STOP still being generated (a few SCL periods)
+#define I2C_STOP_SPIN      2000U
+
+// NVIC priority for the I2C and DMA interrupts (RTX5 safe, below SVC/PendSV)
+#define I2C_IRQ_PRIO       5U
 
 /* =========================================
    2. BARE METAL HELPER (I2C1 Specific)
    ========================================= */
 
+// Derive CCR/DUTY/TRISE from the real APB1 clock. PE must be off.
+static int32_t HW_I2C1_SetSpeed(uint32_t speed) {
+    uint32_t pclk = HAL_RCC_GetPCLK1Freq();
+    uint32_t mhz  = pclk / 1000000U;
+    uint32_t ccr, trise;
+
+    if ((mhz < 2U) || (mhz > 50U)) return ARM_DRIVER_ERROR;
+
+    switch (speed) {
+        case ARM_I2C_BUS_SPEED_STANDARD:
+            // Thigh = Tlow = CCR * Tpclk1
+            ccr = (pclk + (2U * I2C_SM_HZ) - 1U) / (2U * I2C_SM_HZ);
+            if (ccr < 4U) ccr = 4U;
+            trise = ((mhz * I2C_TRISE_SM_NS) / 1000U) + 1U;
+            break;
+
+        case ARM_I2C_BUS_SPEED_FAST:
+            if ((pclk % 10000000U) == 0U) {
+                // DUTY = 1: Tlow/Thigh = 16/9, exact 400 kHz on 10 MHz multiples
+                ccr = (pclk + (25U * I2C_FM_HZ) - 1U) / (25U * I2C_FM_HZ);
+                ccr |= I2C_CCR_DUTY;
+            } else {
+                // DUTY = 0: Tlow/Thigh = 2 (42 MHz -> CCR 35, exactly 400 kHz)
+                ccr = (pclk + (3U * I2C_FM_HZ) - 1U) / (3U * I2C_FM_HZ);
+            }
+            if ((ccr & I2C_CCR_CCR) == 0U) ccr |= 1U;
+            ccr |= I2C_CCR_FS;
+            trise = ((mhz * I2C_TRISE_FM_NS) / 1000U) + 1U;
+            break;
+
+        default:
+            // Fast-mode Plus / High-speed are not implemented by the F40x I2C cell
+            return ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+
+    I2C1->CR2   = (I2C1->CR2 & ~I2C_CR2_FREQ) | (mhz & I2C_CR2_FREQ);
+    I2C1->CCR   = ccr;
+    I2C1->TRISE = trise & I2C_TRISE_TRISE;
+    return ARM_DRIVER_OK;
+}
+
 static void HW_I2C1_Init(void) {
-    // 1) Enable Clocks for I2C1 and GPIOB
-    RCC->AHB1ENR |= RCC_AHB1ENR_GPIOBEN;
+    // 1) Enable Clocks for I2C1, GPIOB and DMA1
+    RCC->AHB1ENR |= RCC_AHB1ENR_GPIOBEN | RCC_AHB1ENR_DMA1EN;
     RCC->APB1ENR |= RCC_APB1ENR_I2C1EN;
     (void)RCC->APB1ENR; // Short delay
 
@@ -44,21 +104,137 @@ static void HW_I2C1_Init(void) {
     I2C1->CR1 |= I2C_CR1_SWRST; // Soft Reset
     I2C1->CR1 &= ~I2C_CR1_SWRST;
 
-    I2C1->CR2 = (I2C_PCLK1_MHZ & 0x3FU); // Set Frequency
-    I2C1->CCR = I2C_CCR_SM_100K;         // Standard Mode
-    I2C1->TRISE = I2C_TRISE_SM;
+    I2C1->CR2 = 0U;
+    HW_I2C1_SetSpeed(ARM_I2C_BUS_SPEED_STANDARD); // Standard Mode until Control() says otherwise
 
     I2C1->CR1 |= I2C_CR1_PE; // Enable Peripheral
+
+    // 4) DMA streams: peripheral address fixed to DR, everything else per transfer
+    I2C_DMA_RX->CR &= ~DMA_SxCR_EN;
+    I2C_DMA_TX->CR &= ~DMA_SxCR_EN;
+    I2C_DMA_RX->PAR = (uint32_t)&I2C1->DR;
+    I2C_DMA_TX->PAR = (uint32_t)&I2C1->DR;
+
+    // 5) Interrupts: event, error and both DMA streams
+    NVIC_SetPriority(I2C1_EV_IRQn,      I2C_IRQ_PRIO);
+    NVIC_SetPriority(I2C1_ER_IRQn,      I2C_IRQ_PRIO);
+    NVIC_SetPriority(DMA1_Stream0_IRQn, I2C_IRQ_PRIO);
+    NVIC_SetPriority(DMA1_Stream6_IRQn, I2C_IRQ_PRIO);
+    NVIC_EnableIRQ(I2C1_EV_IRQn);
+    NVIC_EnableIRQ(I2C1_ER_IRQn);
+    NVIC_EnableIRQ(DMA1_Stream0_IRQn);
+    NVIC_EnableIRQ(DMA1_Stream6_IRQn);
 }
 
 /* =========================================
-   3. CMSIS-DRIVER INTERFACE
+   3. TRANSFER STATE (shared with the IRQs)
    ========================================= */
 
+typedef struct {
+    uint8_t          *data;     // Caller buffer (const dropped for TX)
+    uint32_t          num;      // Requested byte count
+    volatile uint32_t cnt;      // Bytes moved by the IRQ path
+    uint8_t           addr;     // 8-bit bus address incl. R/W bit
+    uint8_t           rx;       // 1 = receive, 0 = transmit
+    uint8_t           dma;      // 1 = DMA moves the data bytes
+    uint8_t           pending;  // xfer_pending: no STOP at the end
+} I2C_XFER;
+
 static ARM_I2C_SignalEvent_t cb_event_ptr = NULL;
+static I2C_XFER              xfer;
+static volatile ARM_I2C_STATUS xfer_status;
+static volatile uint8_t      bus_owned = 0U; // Bus kept after a pending transfer
+
+static void I2C_DMA_Stop(DMA_Stream_TypeDef *stream) {
+    stream->CR &= ~DMA_SxCR_EN;
+    while (stream->CR & DMA_SxCR_EN);
+}
+
+static uint32_t I2C_DMA_Remaining(void) {
+    return xfer.rx ? I2C_DMA_RX->NDTR : I2C_DMA_TX->NDTR;
+}
+
+// End of transfer (called from IRQ context only)
+static void I2C_Complete(uint32_t event) {
+    I2C1->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN |
+                   I2C_CR2_DMAEN   | I2C_CR2_LAST);
+
+    if (xfer.dma) {
+        xfer.cnt = xfer.num - I2C_DMA_Remaining();
+        I2C_DMA_Stop(xfer.rx ? I2C_DMA_RX : I2C_DMA_TX);
+    }
+    if (xfer.cnt < xfer.num) {
+        event |= ARM_I2C_EVENT_TRANSFER_INCOMPLETE;
+    }
+
+    bus_owned = (xfer.pending && !(event & (ARM_I2C_EVENT_BUS_ERROR | ARM_I2C_EVENT_ARBITRATION_LOST))) ? 1U : 0U;
+    xfer_status.busy = 0U;
+
+    if (cb_event_ptr != NULL) {
+        cb_event_ptr(event);
+    }
+}
+
+// Program one master transfer and hand it to the IRQs
+static int32_t I2C_MasterStart(uint32_t addr, uint8_t *data, uint32_t num, bool xfer_pending, uint8_t rx) {
+    if ((data == NULL) || (num == 0U) || (addr > 0x7FU)) return ARM_DRIVER_ERROR_PARAMETER;
+    if (xfer_status.busy) return ARM_DRIVER_ERROR_BUSY;
+    if (!bus_owned) {
+        // The STOP of the previous transfer may still be on the wire
+        uint32_t spin = I2C_STOP_SPIN;
+        while ((I2C1->CR1 & I2C_CR1_STOP) && --spin);
+        if (I2C1->SR2 & I2C_SR2_BUSY) return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    xfer.data    = data;
+    xfer.num     = num;
+    xfer.cnt     = 0U;
+    xfer.addr    = (uint8_t)((addr << 1) | (rx ? 0x01U : 0x00U));
+    xfer.rx      = rx;
+    xfer.dma     = (num >= I2C_DMA_MIN_BYTES) ? 1U : 0U;
+    xfer.pending = xfer_pending ? 1U : 0U;
+
+    xfer_status.busy             = 1U;
+    xfer_status.mode             = 1U; // Master
+    xfer_status.direction        = rx;
+    xfer_status.general_call     = 0U;
+    xfer_status.arbitration_lost = 0U;
+    xfer_status.bus_error        = 0U;
+
+    if (xfer.dma) {
+        DMA_Stream_TypeDef *s = rx ? I2C_DMA_RX : I2C_DMA_TX;
+
+        I2C_DMA_Stop(s);
+        if (rx) DMA1->LIFCR = DMA_LIFCR_CTCIF0 | DMA_LIFCR_CTEIF0 | DMA_LIFCR_CDMEIF0 | DMA_LIFCR_CFEIF0 | DMA_LIFCR_CHTIF0;
+        else    DMA1->HIFCR = DMA_HIFCR_CTCIF6 | DMA_HIFCR_CTEIF6 | DMA_HIFCR_CDMEIF6 | DMA_HIFCR_CFEIF6 | DMA_HIFCR_CHTIF6;
+
+        s->M0AR = (uint32_t)data;
+        s->NDTR = num;
+        s->FCR  = 0U; // Direct mode
+        s->CR   = I2C_DMA_CHANNEL | DMA_SxCR_MINC | DMA_SxCR_TEIE |
+                  (rx ? DMA_SxCR_TCIE : DMA_SxCR_DIR_0);
+        s->CR  |= DMA_SxCR_EN;
+
+        I2C1->CR2 |= I2C_CR2_DMAEN | (rx ? I2C_CR2_LAST : 0U);
+    }
+
+    I2C1->CR1 &= ~I2C_CR1_POS;
+    if (rx && (num > 1U)) I2C1->CR1 |=  I2C_CR1_ACK;
+    else                  I2C1->CR1 &= ~I2C_CR1_ACK;
+
+    // Enable event/error IRQs, then (repeated) START
+    I2C1->CR2 |= I2C_CR2_ITEVTEN | I2C_CR2_ITERREN;
+    I2C1->CR1 |= I2C_CR1_START;
+
+    return ARM_DRIVER_OK;
+}
+
+/* =========================================
+   4. CMSIS-DRIVER INTERFACE
+   ========================================= */
 
 static ARM_DRIVER_VERSION I2C_GetVersion(void) {
-    ARM_DRIVER_VERSION ver = {ARM_I2C_API_VERSION, 1U};
+    ARM_DRIVER_VERSION ver = {ARM_I2C_API_VERSION, 2U};
     return ver;
 }
 
@@ -70,12 +246,19 @@ static ARM_I2C_CAPABILITIES I2C_GetCapabilities(void) {
 
 static int32_t I2C_Initialize (ARM_I2C_SignalEvent_t cb_event) {
     cb_event_ptr = cb_event;
-    HW_I2C1_Init(); 
+    memset((void *)&xfer_status, 0, sizeof(xfer_status));
+    bus_owned = 0U;
+    HW_I2C1_Init();
     return ARM_DRIVER_OK;
 }
 
 static int32_t I2C_Uninitialize (void) {
+    NVIC_DisableIRQ(I2C1_EV_IRQn);
+    NVIC_DisableIRQ(I2C1_ER_IRQn);
+    NVIC_DisableIRQ(DMA1_Stream0_IRQn);
+    NVIC_DisableIRQ(DMA1_Stream6_IRQn);
     I2C1->CR1 &= ~I2C_CR1_PE;
+    cb_event_ptr = NULL;
     return ARM_DRIVER_OK;
 }
 
@@ -91,114 +274,178 @@ static int32_t I2C_PowerControl (ARM_POWER_STATE state) {
 }
 
 static int32_t I2C_MasterTransmit (uint32_t addr, const uint8_t *data, uint32_t num, bool xfer_pending) {
-    if ((data == NULL) || (num == 0U)) return ARM_DRIVER_ERROR_PARAMETER;
-    
-    uint32_t timeout;
+    return I2C_MasterStart(addr, (uint8_t *)data, num, xfer_pending, 0U);
+}
 
-    // Start
-    I2C1->CR1 |= I2C_CR1_START;
-    timeout = I2C_TIMEOUT;
-    while (!(I2C1->SR1 & I2C_SR1_SB)) { if (--timeout == 0) return ARM_DRIVER_ERROR_TIMEOUT; }
+static int32_t I2C_MasterReceive (uint32_t addr, uint8_t *data, uint32_t num, bool xfer_pending) {
+    return I2C_MasterStart(addr, data, num, xfer_pending, 1U);
+}
 
-    // Address (Write)
-    I2C1->DR = (uint8_t)((addr << 1) & 0xFEU);
-    timeout = I2C_TIMEOUT;
-    while (!(I2C1->SR1 & I2C_SR1_ADDR)) { if (--timeout == 0) return ARM_DRIVER_ERROR_TIMEOUT; }
-    (void)I2C1->SR2; 
+// ... (Stubs for Slave unchanged) ...
+static int32_t I2C_SlaveTransmit (const uint8_t *data, uint32_t num) { (void)data; (void)num; return ARM_DRIVER_ERROR_UNSUPPORTED; }
+static int32_t I2C_SlaveReceive (uint8_t *data, uint32_t num) { (void)data; (void)num; return ARM_DRIVER_ERROR_UNSUPPORTED; }
 
-    // Data
-    for (uint32_t i = 0U; i < num; i++) {
-        timeout = I2C_TIMEOUT;
-        while (!(I2C1->SR1 & I2C_SR1_TXE)) { if (--timeout == 0) return ARM_DRIVER_ERROR_TIMEOUT; }
-        I2C1->DR = data[i];
+static int32_t I2C_GetDataCount (void) {
+    if (xfer_status.busy && xfer.dma) {
+        return (int32_t)(xfer.num - I2C_DMA_Remaining());
     }
+    return (int32_t)xfer.cnt;
+}
 
-    // Wait for BTF
-    timeout = I2C_TIMEOUT;
-    while (!(I2C1->SR1 & I2C_SR1_BTF)) { if (--timeout == 0) return ARM_DRIVER_ERROR_TIMEOUT; }
+static int32_t I2C_Control (uint32_t control, uint32_t arg) {
+    if (control == ARM_I2C_BUS_SPEED) {
+        int32_t  status;
+        uint32_t pe;
 
-    // Stop
-    if (!xfer_pending) {
-        I2C1->CR1 |= I2C_CR1_STOP;
+        if (xfer_status.busy || bus_owned) return ARM_DRIVER_ERROR_BUSY;
+
+        pe = I2C1->CR1 & I2C_CR1_PE;
+        I2C1->CR1 &= ~I2C_CR1_PE;
+        status = HW_I2C1_SetSpeed(arg);
+        I2C1->CR1 |= pe;
+        return status;
+    }
+
+    if (control == ARM_I2C_ABORT_TRANSFER) {
+        NVIC_DisableIRQ(I2C1_EV_IRQn);
+        I2C1->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN |
+                       I2C_CR2_DMAEN   | I2C_CR2_LAST);
+        if (xfer.dma) {
+            xfer.cnt = xfer.num - I2C_DMA_Remaining();
+            I2C_DMA_Stop(xfer.rx ? I2C_DMA_RX : I2C_DMA_TX);
+        }
+        if (xfer_status.busy || bus_owned) {
+            I2C1->CR1 |= I2C_CR1_STOP;
+        }
+        xfer_status.busy = 0U;
+        bus_owned = 0U;
+        NVIC_EnableIRQ(I2C1_EV_IRQn);
+        return ARM_DRIVER_OK;
     }
     return ARM_DRIVER_OK;
 }
 
-static int32_t I2C_MasterReceive (uint32_t addr, uint8_t *data, uint32_t num, bool xfer_pending) {
-    if ((data == NULL) || (num == 0U)) return ARM_DRIVER_ERROR_PARAMETER;
-    
-    uint32_t timeout;
+static ARM_I2C_STATUS I2C_GetStatus (void) {
+    ARM_I2C_STATUS s = xfer_status;
+    return s;
+}
 
-    // Start
-    I2C1->CR1 |= I2C_CR1_START;
-    timeout = I2C_TIMEOUT;
-    while (!(I2C1->SR1 & I2C_SR1_SB)) { if (--timeout == 0) return ARM_DRIVER_ERROR_TIMEOUT; }
-
-    // Address (Read)
-    I2C1->DR = (uint8_t)((addr << 1) | 0x01U);
-    timeout = I2C_TIMEOUT;
-    while (!(I2C1->SR1 & I2C_SR1_ADDR)) { if (--timeout == 0) return ARM_DRIVER_ERROR_TIMEOUT; }
-
-    // Note: Use simple state machine for RX to handle NACK/STOP timing correctly
-    if (num == 1U) {
-        // 1 Byte Read
-        I2C1->CR1 &= ~I2C_CR1_ACK;
-        (void)I2C1->SR2;            // Clear ADDR
+/* =========================================
+   5. INTERRUPT HANDLERS
+   ========================================= */
+
+void I2C1_EV_IRQHandler(void) {
+    uint32_t sr1 = I2C1->SR1;
+
+    // START sent: put the address on the bus
+    if (sr1 & I2C_SR1_SB) {
+        I2C1->DR = xfer.addr;
+        return;
+    }
+
+    // Address acknowledged
+    if (sr1 & I2C_SR1_ADDR) {
+        if (xfer.rx && !xfer.dma) {
+            // 1 byte read: NACK + STOP must be set around the ADDR clear
+            I2C1->CR1 &= ~I2C_CR1_ACK;
+            (void)I2C1->SR2;
+            if (!xfer.pending) I2C1->CR1 |= I2C_CR1_STOP;
+            I2C1->CR2 |= I2C_CR2_ITBUFEN;
+        } else {
+            (void)I2C1->SR2;
+            if (!xfer.dma) I2C1->CR2 |= I2C_CR2_ITBUFEN;
+        }
+        return;
+    }
+
+    if (xfer.rx) {
+        // Only the single byte (non-DMA) receive gets here
+        if ((sr1 & I2C_SR1_RXNE) && (xfer.cnt < xfer.num)) {
+            xfer.data[xfer.cnt++] = (uint8_t)I2C1->DR;
+            I2C_Complete(ARM_I2C_EVENT_TRANSFER_DONE);
+        }
+        return;
+    }
+
+    // Transmit: feed bytes while the IRQ path owns the data
+    if (!xfer.dma && (sr1 & I2C_SR1_TXE) && !(sr1 & I2C_SR1_BTF) && (xfer.cnt < xfer.num)) {
+        I2C1->DR = xfer.data[xfer.cnt++];
+        if (xfer.cnt == xfer.num) I2C1->CR2 &= ~I2C_CR2_ITBUFEN;
+        return;
+    }
+
+    // Last byte shifted out
+    if (sr1 & I2C_SR1_BTF) {
+        uint32_t done = xfer.dma ? (I2C_DMA_TX->NDTR == 0U) : (xfer.cnt == xfer.num);
+        if (done) {
+            if (xfer.dma) xfer.cnt = xfer.num;
+            if (!xfer.pending) I2C1->CR1 |= I2C_CR1_STOP;
+            I2C_Complete(ARM_I2C_EVENT_TRANSFER_DONE);
+        }
+    }
+}
+
+void I2C1_ER_IRQHandler(void) {
+    uint32_t sr1   = I2C1->SR1;
+    uint32_t event = 0U;
+
+    if (sr1 & I2C_SR1_AF) {
+        // NACK: during the address phase nothing has been moved yet
+        I2C1->SR1 &= ~I2C_SR1_AF;
+        if ((xfer.cnt == 0U) && (!xfer.dma || (I2C_DMA_Remaining() == xfer.num))) {
+            event |= ARM_I2C_EVENT_ADDRESS_NACK;
+        }
         I2C1->CR1 |= I2C_CR1_STOP;
-        
-        timeout = I2C_TIMEOUT;
-        while (!(I2C1->SR1 & I2C_SR1_RXNE)) { if (--timeout == 0) return ARM_DRIVER_ERROR_TIMEOUT; }
-        data[0] = (uint8_t)I2C1->DR;
-        
-    } else if (num == 2U) {
-        // 2 Byte Read
-        I2C1->CR1 |= I2C_CR1_POS;
-        I2C1->CR1 &= ~I2C_CR1_ACK;
-        (void)I2C1->SR2;            // Clear ADDR
-        
-        timeout = I2C_TIMEOUT;
-        while (!(I2C1->SR1 & I2C_SR1_BTF)) { if (--timeout == 0) return ARM_DRIVER_ERROR_TIMEOUT; }
-        
+        xfer.pending = 0U;
+    }
+    if (sr1 & I2C_SR1_ARLO) {
+        I2C1->SR1 &= ~I2C_SR1_ARLO;
+        xfer_status.arbitration_lost = 1U;
+        event |= ARM_I2C_EVENT_ARBITRATION_LOST;
+    }
+    if (sr1 & I2C_SR1_BERR) {
+        I2C1->SR1 &= ~I2C_SR1_BERR;
+        xfer_status.bus_error = 1U;
+        event |= ARM_I2C_EVENT_BUS_ERROR;
         I2C1->CR1 |= I2C_CR1_STOP;
-        data[0] = (uint8_t)I2C1->DR;
-        data[1] = (uint8_t)I2C1->DR;
-        I2C1->CR1 &= ~I2C_CR1_POS;
-        
-    } else {
-        // N > 2 Bytes
-        I2C1->CR1 |= I2C_CR1_ACK;
-        (void)I2C1->SR2;            // Clear ADDR
-        
-        uint32_t i = 0U;
-        while (i < (num - 3U)) {
-            timeout = I2C_TIMEOUT;
-            while (!(I2C1->SR1 & I2C_SR1_RXNE)) { if (--timeout == 0) return ARM_DRIVER_ERROR_TIMEOUT; }
-            data[i++] = (uint8_t)I2C1->DR;
-        }
-        // Wait for BTF (N-2 received, N-1 in shift register)
-        timeout = I2C_TIMEOUT;
-        while (!(I2C1->SR1 & I2C_SR1_BTF)) { if (--timeout == 0) return ARM_DRIVER_ERROR_TIMEOUT; }
-        
-        I2C1->CR1 &= ~I2C_CR1_ACK; // NACK
-        data[i++] = (uint8_t)I2C1->DR; // Read N-2
-        
-        I2C1->CR1 |= I2C_CR1_STOP; // STOP
-        data[i++] = (uint8_t)I2C1->DR; // Read N-1
-        
-        timeout = I2C_TIMEOUT;
-        while (!(I2C1->SR1 & I2C_SR1_RXNE)) { if (--timeout == 0) return ARM_DRIVER_ERROR_TIMEOUT; }
-        data[i++] = (uint8_t)I2C1->DR; // Read N
+    }
+    if (sr1 & I2C_SR1_OVR) {
+        I2C1->SR1 &= ~I2C_SR1_OVR;
     }
 
-    return ARM_DRIVER_OK;
+    if (xfer_status.busy) {
+        I2C_Complete(event);
+    }
 }
 
-// ... (Stubs for Slave/Control unchanged) ...
-static int32_t I2C_SlaveTransmit (const uint8_t *data, uint32_t num) { (void)data; (void)num; return ARM_DRIVER_ERROR_UNSUPPORTED; }
-static int32_t I2C_SlaveReceive (uint8_t *data, uint32_t num) { (void)data; (void)num; return ARM_DRIVER_ERROR_UNSUPPORTED; }
-static int32_t I2C_GetDataCount (void) { return 0; }
-static int32_t I2C_Control (uint32_t control, uint32_t arg) { (void)control; (void)arg; return ARM_DRIVER_OK; }
-static ARM_I2C_STATUS I2C_GetStatus (void) { ARM_I2C_STATUS s = {0}; return s; }
+// RX DMA: all bytes in memory (hardware NACKed the last one via LAST)
+void DMA1_Stream0_IRQHandler(void) {
+    uint32_t isr = DMA1->LISR;
+    DMA1->LIFCR = DMA_LIFCR_CTCIF0 | DMA_LIFCR_CTEIF0 | DMA_LIFCR_CHTIF0 | DMA_LIFCR_CDMEIF0 | DMA_LIFCR_CFEIF0;
+
+    if (!xfer_status.busy) return;
+
+    if (isr & DMA_LISR_TEIF0) {
+        xfer_status.bus_error = 1U;
+        I2C1->CR1 |= I2C_CR1_STOP;
+        I2C_Complete(ARM_I2C_EVENT_BUS_ERROR);
+    } else if (isr & DMA_LISR_TCIF0) {
+        if (!xfer.pending) I2C1->CR1 |= I2C_CR1_STOP;
+        I2C_Complete(ARM_I2C_EVENT_TRANSFER_DONE);
+    }
+}
+
+// TX DMA: completion is signalled by BTF in the event IRQ, only errors here
+void DMA1_Stream6_IRQHandler(void) {
+    uint32_t isr = DMA1->HISR;
+    DMA1->HIFCR = DMA_HIFCR_CTCIF6 | DMA_HIFCR_CTEIF6 | DMA_HIFCR_CHTIF6 | DMA_HIFCR_CDMEIF6 | DMA_HIFCR_CFEIF6;
+
+    if (xfer_status.busy && (isr & DMA_HISR_TEIF6)) {
+        xfer_status.bus_error = 1U;
+        I2C1->CR1 |= I2C_CR1_STOP;
+        I2C_Complete(ARM_I2C_EVENT_BUS_ERROR);
+    }
+}
 
 ARM_DRIVER_I2C Driver_I2C1 = {
     I2C_GetVersion,
@@ -213,4 +460,4 @@ ARM_DRIVER_I2C Driver_I2C1 = {
     I2C_GetDataCount,
     I2C_Control,
     I2C_GetStatus
-};
\ No newline at end of file
+};
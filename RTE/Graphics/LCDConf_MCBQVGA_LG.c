@@ -54,6 +54,9 @@ Purpose     : Display controller configuration
 #include "GUI.h"
 #include "GUIDRV_FlexColor.h"
 #include "LCD_X.h"
+#ifdef RTE_Graphics_LCD_MCBQVGA_LG_16
+#include "lcd_dma.h"
+#endif
 
 /*********************************************************************
 *
@@ -290,6 +293,34 @@ void LCD_X_ReadM1_16(U16 * pData, int NumWords) {
 
 #endif
 
+#ifdef RTE_Graphics_LCD_MCBQVGA_LG_16
+
+/*********************************************************************
+*
+*       DMA pixel pump (lcd_dma.c)
+*
+* Purpose:
+*   Pixel runs go out through DMA2 memory-to-memory transfers to the
+*   FSMC data address; solid fills complete in the background. Every
+*   other controller access first waits for the pump to drain.
+*/
+static void _Write0_16(U16 c) {
+  LCD_DMA_Wait();
+  LCD_X_Write0_16(c);
+}
+
+static void _Write1_16(U16 c) {
+  LCD_DMA_Wait();
+  LCD_X_Write1_16(c);
+}
+
+static void _ReadM1_16(U16 * pData, int NumWords) {
+  LCD_DMA_Wait();
+  LCD_X_ReadM1_16(pData, NumWords);
+}
+
+#endif
+
 /*********************************************************************
 *
 *       Private code
@@ -297,6 +328,9 @@ void LCD_X_ReadM1_16(U16 * pData, int NumWords) {
 **********************************************************************
 */
 static void wr_reg (U16 reg, U16 dat) {
+#ifdef RTE_Graphics_LCD_MCBQVGA_LG_16
+  LCD_DMA_Wait();
+#endif
   LCD_X_Write0_16(reg);
   LCD_X_Write1_16(dat);
 }
@@ -312,6 +346,9 @@ static void _InitController(void) {
 #ifndef WIN32
 
   LCD_X_Init();
+#ifdef RTE_Graphics_LCD_MCBQVGA_LG_16
+  LCD_DMA_Init();             /* FSMC is up: the pixel pump can start */
+#endif
 
   /* Driving ability settings --------------------------------------*/
   wr_reg(0xEA, 0x00);         /* Power control internal used (1)    */
@@ -406,6 +443,65 @@ static void _InitController(void) {
 *
 **********************************************************************
 */
+/*********************************************************************
+*
+*       LCD_X_SetScrollStart
+*
+* Purpose:
+*   GRAM line shown on the first line of the scrolling area (VSP).
+*   Must lie in [tfa, tfa + vsa); the area wraps around from there.
+*/
+void LCD_X_SetScrollStart(U16 line) {
+  wr_reg(0x14, line >> 8);    /* VSP MSB                            */
+  wr_reg(0x15, line & 0xFF);  /* VSP LSB                            */
+}
+
+/*********************************************************************
+*
+*       LCD_X_SetScrollArea
+*
+* Purpose:
+*   Splits the 320 gate lines into a fixed top area (TFA), a scrolling
+*   area (VSA) and a fixed bottom area (BFA); tfa + vsa + bfa = 320.
+*   A full-height VSA with no fixed areas turns scrolling off again.
+*/
+void LCD_X_SetScrollArea(U16 tfa, U16 vsa, U16 bfa) {
+  wr_reg(0x0E, tfa >> 8);     /* TFA MSB                            */
+  wr_reg(0x0F, tfa & 0xFF);   /* TFA LSB                            */
+  wr_reg(0x10, vsa >> 8);     /* VSA MSB                            */
+  wr_reg(0x11, vsa & 0xFF);   /* VSA LSB                            */
+  wr_reg(0x12, bfa >> 8);     /* BFA MSB                            */
+  wr_reg(0x13, bfa & 0xFF);   /* BFA LSB                            */
+  if (vsa >= YSIZE_PHYS) {
+    LCD_X_SetScrollStart(0);
+    wr_reg(0x01, 0x00);       /* Normal mode, no scroll             */
+  } else {
+    wr_reg(0x01, 0x08);       /* Scroll mode on                     */
+  }
+}
+
+/*********************************************************************
+*
+*       LCD_X_SetWindow
+*
+* Purpose:
+*   Opens a GRAM write window (physical columns x0..x1, lines y0..y1)
+*   and issues the memory write command. Pixel data written after it
+*   fills the window row by row. emWin sets its own window for every
+*   drawing operation, so this does not disturb the driver.
+*/
+void LCD_X_SetWindow(U16 x0, U16 y0, U16 x1, U16 y1) {
+  wr_reg(0x02, x0 >> 8);      /* Column address start MSB           */
+  wr_reg(0x03, x0 & 0xFF);    /* Column address start LSB           */
+  wr_reg(0x04, x1 >> 8);      /* Column address end MSB             */
+  wr_reg(0x05, x1 & 0xFF);    /* Column address end LSB             */
+  wr_reg(0x06, y0 >> 8);      /* Row address start MSB              */
+  wr_reg(0x07, y0 & 0xFF);    /* Row address start LSB              */
+  wr_reg(0x08, y1 >> 8);      /* Row address end MSB                */
+  wr_reg(0x09, y1 & 0xFF);    /* Row address end LSB                */
+  LCD_X_Write0_16(0x22);      /* Memory write                       */
+}
+
 /*********************************************************************
 *
 *       LCD_X_Config
@@ -447,10 +543,17 @@ void LCD_X_Config(void) {
   //
   // Set controller and operation mode
   //
+#ifdef RTE_Graphics_LCD_MCBQVGA_LG_16
+  PortAPI.pfWrite16_A0  = _Write0_16;
+  PortAPI.pfWrite16_A1  = _Write1_16;
+  PortAPI.pfWriteM16_A1 = LCD_DMA_WriteM16;
+  PortAPI.pfReadM16_A1  = _ReadM1_16;
+#else
   PortAPI.pfWrite16_A0  = LCD_X_Write0_16;
   PortAPI.pfWrite16_A1  = LCD_X_Write1_16;
   PortAPI.pfWriteM16_A1 = LCD_X_WriteM1_16;
   PortAPI.pfReadM16_A1  = LCD_X_ReadM1_16;
+#endif
   GUIDRV_FlexColor_SetFunc(pDevice, &PortAPI, GUIDRV_FLEXCOLOR_F66712, GUIDRV_FLEXCOLOR_M16C0B16);
   //
   // Orientation and offset of SEG/COM lines
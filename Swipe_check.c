@@ -1,162 +1,434 @@
 #include "swipe_check.h"
 #include "input.h"
 #include "GUI.h"
-#include "stm32f4xx.h" 
+#include "cmsis_os2.h"
 #include <stdio.h>
 #include <stdlib.h>
 
 /* =========================================================================
-   CONFIGURATION 
+   CONFIGURATION
    ========================================================================= */
-#define SWIPE_THRESHOLD      45 
-#define SWIPE_DELAY_CYCLES   1500000 
-#define SENSOR_REFRESH_DELAY 200000
+#define GESTURE_HISTORY      16     // Samples in the fitting window (power of two)
+#define GESTURE_OUT_SIZE     4      // Recognized gestures not yet collected (power of two)
 
-// STABLE RELEASE: How many consecutive "No Touch" reads required?
-#define RELEASE_CONFIRM_COUNT 10 
+// Live-tunable thresholds (see StartSwipeCheck)
+#define GESTURE_DEFAULTS {                                                  \
+    .tap_slop        = 10,      /* px a tap or long press may wander */     \
+    .tap_max_ms      = 250,     /* Longest press that still taps */         \
+    .double_tap_ms   = 300,     /* Gap allowed between the two taps */      \
+    .long_press_ms   = 600,                                                 \
+    .swipe_max_ms    = 400,     /* Slower than this is a drag */            \
+    .swipe_min_dist  = 25,      /* px from the touch-down point */          \
+    .swipe_min_speed = 150,     /* px/s of the fitted velocity */           \
+    .bounce_ms       = 30       /* UP then DOWN this fast is one contact */ \
+}
+
+static const Gesture_Tuning_t gesture_defaults = GESTURE_DEFAULTS;
+static Gesture_Tuning_t       gesture_tuning   = GESTURE_DEFAULTS;
+
+typedef enum {
+    GEST_ST_IDLE = 0,       // No finger (a tap may be waiting for its double)
+    GEST_ST_PRESS,          // Down, still inside tap_slop
+    GEST_ST_MOVE,           // Left tap_slop, flick or drag not decided yet
+    GEST_ST_DRAG,           // Slow movement, DRAG reported on every sample
+    GEST_ST_HELD,           // Long press reported, waiting for the finger to lift
+    GEST_ST_LIFT            // UP seen, waiting out bounce_ms before deciding
+} Gesture_State_t;
+
+typedef struct {
+    int16_t  x, y;
+    int32_t  t;             // ms since touch-down
+} Gesture_Pt_t;
+
+static Gesture_State_t gest_state = GEST_ST_IDLE;
+static Gesture_State_t lift_from;       // State the contact was in when UP arrived
+static int16_t  start_x, start_y;
+static uint32_t start_tick;
+static uint32_t up_tick;
+
+// Tap waiting for a possible second tap
+static uint8_t  tap_pending;
+static uint8_t  second_press;           // Current press started inside the double-tap gap
+static uint32_t tap_tick;
+
+/* --- Sliding least-squares window: x(t), y(t) fitted with O(1) updates --- */
+static Gesture_Pt_t hist[GESTURE_HISTORY];
+static uint32_t hist_n, hist_head;
+static int64_t  sum_t, sum_tt, sum_x, sum_y, sum_tx, sum_ty;
 
-// COOLDOWN: Extra dead time AFTER release (approx 150-200ms)
-#define COOLDOWN_CYCLES      3000000
+static Gesture_Info_t gest_info;
+
+/* --- Output ring: several gestures may resolve in one call --- */
+static Swipe_Dir_t gest_out[GESTURE_OUT_SIZE];
+static uint32_t    out_head, out_tail;
 
 static int16_t debug_x = 0;
 static int16_t debug_y = 0;
 
 /* =========================================================================
-   CORE LOGIC: SNAPSHOT + RELEASE CHECK + COOLDOWN
+   FITTING
    ========================================================================= */
-Swipe_Dir_t Touch_Update_Swipe(void) {
-    int16_t start_x, start_y;
-    int16_t end_x, end_y;
-    int16_t dum_x, dum_y;
-    
-    // 1. Detect Initial Touch
-    if (Touch_GetCoord(&start_x, &start_y)) {
-        
-        debug_x = start_x;
-        debug_y = start_y;
-
-        // 2. LONG WAIT (Movement Window)
-        for(volatile int i=0; i<SWIPE_DELAY_CYCLES; i++); 
-
-        // 3. FLUSH OLD DATA
-        Touch_GetCoord(&dum_x, &dum_y);
-
-        // 4. SHORT WAIT (Refresh Sensor)
-        for(volatile int i=0; i<SENSOR_REFRESH_DELAY; i++); 
-
-        // 5. CAPTURE END POINT
-        if (Touch_GetCoord(&end_x, &end_y)) {
-            
-            debug_x = end_x;
-            debug_y = end_y;
-
-            int16_t dx = end_x - start_x;
-            int16_t dy = end_y - start_y;
-
-            // 6. CALCULATE VECTOR
-            if (abs(dx) > SWIPE_THRESHOLD || abs(dy) > SWIPE_THRESHOLD) {
-                
-                Swipe_Dir_t result = SWIPE_NONE;
-
-                if (abs(dx) > abs(dy)) {
-                    // NOTE: Check if your X axis is inverted.
-                    // If Right Swipe registers as Left, swap these.
-                    result = (dx < 0) ? SWIPE_RIGHT : SWIPE_LEFT; 
-                } else {
-                    result = (dy < 0) ? SWIPE_UP : SWIPE_DOWN;
-                }
-
-                /* ==========================================================
-                   STEP A: STABLE RELEASE CHECK
-                   Wait until we are 100% sure the finger is gone.
-                   ========================================================== */
-                int no_touch_count = 0;
-                
-                while(no_touch_count < RELEASE_CONFIRM_COUNT) {
-                    if(Touch_GetCoord(&dum_x, &dum_y)) {
-                        // Finger detected! Reset counter.
-                        no_touch_count = 0;
-                        debug_x = dum_x; debug_y = dum_y;
-                    } else {
-                        // No finger? Count up.
-                        no_touch_count++;
-                    }
-                    // Small delay between checks
-                    for(volatile int k=0; k<50000; k++);
-                }
-
-                /* ==========================================================
-                   STEP B: COOLDOWN (DEBOUNCE)
-                   Now that the finger is gone, wait an EXTRA moment.
-                   This prevents accidental double-triggers if you tap 
-                   the screen immediately after swiping.
-                   ========================================================== */
-                for(volatile int c=0; c<COOLDOWN_CYCLES; c++);
-
-                // Reset debugs
-                debug_x = 0;
-                debug_y = 0;
-
-                return result;
+static void Gesture_HistReset(void) {
+    hist_n = hist_head = 0;
+    sum_t = sum_tt = sum_x = sum_y = sum_tx = sum_ty = 0;
+}
+
+static void Gesture_HistAccum(const Gesture_Pt_t *p, int sign) {
+    sum_t  += sign * (int64_t)p->t;
+    sum_tt += sign * (int64_t)p->t * p->t;
+    sum_x  += sign * (int64_t)p->x;
+    sum_y  += sign * (int64_t)p->y;
+    sum_tx += sign * (int64_t)p->t * p->x;
+    sum_ty += sign * (int64_t)p->t * p->y;
+}
+
+// Constant time: the oldest sample leaves the sums as the new one enters
+static void Gesture_HistAdd(int16_t x, int16_t y, uint32_t tick) {
+    Gesture_Pt_t *slot = &hist[hist_head & (GESTURE_HISTORY - 1)];
+
+    if (hist_n == GESTURE_HISTORY) Gesture_HistAccum(slot, -1);
+    else                           hist_n++;
+
+    slot->x = x;
+    slot->y = y;
+    slot->t = (int32_t)(tick - start_tick);
+    Gesture_HistAccum(slot, +1);
+    hist_head++;
+}
+
+/* Slope of the least-squares line through the window, in px/s */
+static void Gesture_Fit(int32_t *vx, int32_t *vy) {
+    int64_t n   = hist_n;
+    int64_t den = n * sum_tt - sum_t * sum_t;
+
+    if ((n < 2) || (den == 0)) {
+        // Every sample in one tick (one FIFO burst): no time base to fit
+        *vx = *vy = 0;
+        return;
+    }
+    *vx = (int32_t)((1000 * (n * sum_tx - sum_t * sum_x)) / den);
+    *vy = (int32_t)((1000 * (n * sum_ty - sum_t * sum_y)) / den);
+}
+
+/* =========================================================================
+   RECOGNIZER
+   ========================================================================= */
+static void Gesture_Emit(Swipe_Dir_t g) {
+    // Collapse a run of DRAGs the caller has not collected yet
+    if ((g == SWIPE_DRAG) && (out_head != out_tail) &&
+        (gest_out[(out_head - 1) & (GESTURE_OUT_SIZE - 1)] == SWIPE_DRAG)) return;
+    if ((out_head - out_tail) >= GESTURE_OUT_SIZE) return;
+    gest_out[out_head & (GESTURE_OUT_SIZE - 1)] = g;
+    out_head++;
+}
+
+static int Gesture_OutsideSlop(int16_t x, int16_t y) {
+    return (abs(x - start_x) > gesture_tuning.tap_slop) ||
+           (abs(y - start_y) > gesture_tuning.tap_slop);
+}
+
+// Released after leaving tap_slop inside swipe_max_ms: flick or nothing
+static void Gesture_ResolveSwipe(void) {
+    int16_t dx = gest_info.x - start_x;
+    int16_t dy = gest_info.y - start_y;
+    int32_t vx, vy;
+
+    Gesture_Fit(&vx, &vy);
+    gest_info.vx = vx;
+    gest_info.vy = vy;
+
+    if ((abs(dx) < gesture_tuning.swipe_min_dist) && (abs(dy) < gesture_tuning.swipe_min_dist)) return;
+    if ((abs(vx) < gesture_tuning.swipe_min_speed) && (abs(vy) < gesture_tuning.swipe_min_speed)) return;
+
+    // Direction from the fitted velocity, not the two end points
+    if (abs(vx) > abs(vy)) {
+        // NOTE: Check if your X axis is inverted.
+        // If Right Swipe registers as Left, swap these.
+        Gesture_Emit((vx < 0) ? SWIPE_RIGHT : SWIPE_LEFT);
+    } else {
+        Gesture_Emit((vy < 0) ? SWIPE_UP : SWIPE_DOWN);
+    }
+}
+
+// The contact is over (bounce_ms passed with no new DOWN)
+static void Gesture_Finish(void) {
+    switch (lift_from) {
+        case GEST_ST_PRESS:
+            if ((up_tick - start_tick) > gesture_tuning.tap_max_ms) {
+                if (second_press) Gesture_Emit(SWIPE_TAP);   // First tap stands alone
+                tap_pending = 0;
+            } else if (second_press) {
+                Gesture_Emit(SWIPE_DOUBLE_TAP);
+                tap_pending = 0;
+            } else {
+                tap_pending = 1;                            // TAP once the gap expires
+                tap_tick    = up_tick;
             }
-        }
+            break;
+
+        case GEST_ST_MOVE:
+            Gesture_ResolveSwipe();
+            break;
+
+        default:                                            // DRAG / HELD: already reported
+            break;
+    }
+    second_press = 0;
+    gest_state   = GEST_ST_IDLE;
+}
+
+/* One event in, bounded work */
+static void Gesture_Feed(const Touch_Event_t *ev) {
+    if (ev->type != TOUCH_EVT_UP) {
+        debug_x = gest_info.x = ev->x;
+        debug_y = gest_info.y = ev->y;
+    }
+
+    switch (gest_state) {
+        case GEST_ST_IDLE:
+            if (ev->type != TOUCH_EVT_DOWN) break;
+
+            second_press = tap_pending && ((ev->tick - tap_tick) <= gesture_tuning.double_tap_ms);
+            if (tap_pending && !second_press) Gesture_Emit(SWIPE_TAP);
+            tap_pending = 0;
+
+            start_x    = ev->x;
+            start_y    = ev->y;
+            start_tick = ev->tick;
+            gest_info.vx = gest_info.vy = 0;
+            Gesture_HistReset();
+            Gesture_HistAdd(ev->x, ev->y, ev->tick);
+            gest_state = GEST_ST_PRESS;
+            break;
+
+        case GEST_ST_LIFT:
+            if (ev->type != TOUCH_EVT_DOWN) break;
+            // Contact bounced: carry on where it was
+            gest_state = lift_from;
+            Gesture_HistAdd(ev->x, ev->y, ev->tick);
+            break;
+
+        default:
+            if (ev->type == TOUCH_EVT_UP) {
+                lift_from  = gest_state;
+                up_tick    = ev->tick;
+                gest_state = GEST_ST_LIFT;
+                break;
+            }
+            Gesture_HistAdd(ev->x, ev->y, ev->tick);
+
+            if ((gest_state == GEST_ST_PRESS) && Gesture_OutsideSlop(ev->x, ev->y)) {
+                // Moving: a second press can no longer be a double tap
+                if (second_press) Gesture_Emit(SWIPE_TAP);
+                second_press = 0;
+                gest_state   = GEST_ST_MOVE;
+            }
+            if ((gest_state == GEST_ST_MOVE) && ((ev->tick - start_tick) > gesture_tuning.swipe_max_ms)) {
+                gest_state = GEST_ST_DRAG;
+            }
+            if (gest_state == GEST_ST_DRAG) {
+                Gesture_Fit(&gest_info.vx, &gest_info.vy);
+                Gesture_Emit(SWIPE_DRAG);
+            }
+            break;
+    }
+}
+
+/* Time-only transitions: run once per call even when no event arrived */
+static void Gesture_Tick(uint32_t now) {
+    switch (gest_state) {
+        case GEST_ST_IDLE:
+            if (tap_pending && ((now - tap_tick) > gesture_tuning.double_tap_ms)) {
+                Gesture_Emit(SWIPE_TAP);
+                tap_pending = 0;
+            }
+            break;
+
+        case GEST_ST_PRESS:
+            if ((now - start_tick) >= gesture_tuning.long_press_ms) {
+                if (second_press) Gesture_Emit(SWIPE_TAP);
+                second_press = 0;
+                Gesture_Emit(SWIPE_LONG_PRESS);
+                gest_state = GEST_ST_HELD;
+            }
+            break;
+
+        case GEST_ST_MOVE:
+            // Parked after moving: it is a drag now
+            if ((now - start_tick) > gesture_tuning.swipe_max_ms) gest_state = GEST_ST_DRAG;
+            break;
+
+        case GEST_ST_LIFT:
+            if ((now - up_tick) >= gesture_tuning.bounce_ms) Gesture_Finish();
+            break;
+
+        default:
+            break;
     }
-    
-    return SWIPE_NONE;
+}
+
+/*
+ * Non-blocking: drains the pending touch events, advances the recognizer
+ * and returns the oldest recognized gesture. Call it every frame.
+ */
+Swipe_Dir_t Touch_Update_Swipe(void) {
+    Touch_Event_t ev[8];
+    int n;
+
+    while ((n = Touch_PollEvents(ev, 8)) > 0) {
+        for (int i = 0; i < n; i++) Gesture_Feed(&ev[i]);
+    }
+    Gesture_Tick(osKernelGetTickCount());
+
+    if (out_tail == out_head) return SWIPE_NONE;
+    return gest_out[out_tail++ & (GESTURE_OUT_SIZE - 1)];
+}
+
+/* Forget any half-seen gesture (e.g. when a game starts) */
+void Touch_Reset_Swipe(void) {
+    Touch_FlushEvents();
+    gest_state   = GEST_ST_IDLE;
+    tap_pending  = 0;
+    second_press = 0;
+    out_tail     = out_head;
+    debug_x = 0;
+    debug_y = 0;
+}
+
+/* Position and fitted velocity behind the last reported gesture */
+void Touch_Get_Gesture_Info(Gesture_Info_t *info) {
+    *info = gest_info;
+}
+
+Gesture_Tuning_t *Touch_Gesture_Tuning(void) {
+    return &gesture_tuning;
 }
 
 /* =========================================================================
-   VISUAL TEST MENU
+   LIVE TUNING SCREEN
    ========================================================================= */
+typedef struct {
+    const char *name;
+    uint16_t   *value;
+    uint16_t    step;
+} Tuning_Row_t;
+
+static const Tuning_Row_t tuning_rows[] = {
+    {"Tap slop px",     &gesture_tuning.tap_slop,        2},
+    {"Tap max ms",      &gesture_tuning.tap_max_ms,      25},
+    {"Double gap ms",   &gesture_tuning.double_tap_ms,   25},
+    {"Long press ms",   &gesture_tuning.long_press_ms,   50},
+    {"Swipe max ms",    &gesture_tuning.swipe_max_ms,    25},
+    {"Swipe dist px",   &gesture_tuning.swipe_min_dist,  5},
+    {"Swipe speed px/s",&gesture_tuning.swipe_min_speed, 25},
+    {"Bounce ms",       &gesture_tuning.bounce_ms,       5}
+};
+#define TUNING_ROWS   (int)(sizeof(tuning_rows) / sizeof(tuning_rows[0]))
+#define TUNING_Y0     40
+#define TUNING_DY     16
+#define PAD_Y0        (TUNING_Y0 + TUNING_ROWS * TUNING_DY + 4)
+#define PAD_Y1        280
+
+static const char *Gesture_Name(Swipe_Dir_t g) {
+    switch (g) {
+        case SWIPE_UP:          return "UP";
+        case SWIPE_DOWN:        return "DOWN";
+        case SWIPE_LEFT:        return "LEFT";
+        case SWIPE_RIGHT:       return "RIGHT";
+        case SWIPE_TAP:         return "TAP";
+        case SWIPE_DOUBLE_TAP:  return "DOUBLE TAP";
+        case SWIPE_LONG_PRESS:  return "LONG PRESS";
+        case SWIPE_DRAG:        return "DRAG";
+        default:                return "";
+    }
+}
+
+static void DrawTuningRows(int sel) {
+    char buf[32];
+
+    GUI_SetFont(GUI_FONT_13_1);
+    for (int i = 0; i < TUNING_ROWS; i++) {
+        GUI_SetColor((i == sel) ? GUI_YELLOW : GUI_WHITE);
+        sprintf(buf, "%c %-16s %5u   ", (i == sel) ? '>' : ' ', tuning_rows[i].name, *tuning_rows[i].value);
+        GUI_DispStringAt(buf, 4, TUNING_Y0 + i * TUNING_DY);
+    }
+}
+
 void StartSwipeCheck(void) {
-    GUI_Clear();
     GUI_SetBkColor(GUI_BLACK);
+    GUI_Clear();
     GUI_SetColor(GUI_WHITE);
-    
+
     GUI_SetFont(GUI_FONT_20_ASCII);
-    GUI_DispStringHCenterAt("FULL SAFE SWIPE TEST", 120, 10);
+    GUI_DispStringHCenterAt("GESTURE TUNING", 120, 10);
     GUI_DrawLine(0, 35, 240, 35);
-    
-    GUI_SetFont(GUI_FONT_16_ASCII);
-    GUI_DispStringHCenterAt("Release + Cooldown", 120, 40);
-    GUI_DispStringHCenterAt("Press '#' to Exit", 120, 300);
 
-    char buf[32];
+    GUI_SetFont(GUI_FONT_13_1);
+    GUI_DispStringHCenterAt("2/8 select  4/6 adjust  0 reset  # exit", 120, 300);
+
+    char buf[40];
+    char last_key = 0;
+    int  sel = 0;
+    int  dirty = 1;
+    uint32_t shown_tick = 0;        // When the current result went up, 0 = none
+
+    Touch_Reset_Swipe();
+    GUI_DrawRect(0, PAD_Y0, 239, PAD_Y1);
 
     while(1) {
         Swipe_Dir_t dir = Touch_Update_Swipe();
-        
-        GUI_SetColor(GUI_YELLOW);
-        GUI_SetFont(GUI_FONT_16_ASCII);
-        sprintf(buf, "X: %03d   Y: %03d   ", debug_x, debug_y); 
-        GUI_DispStringAt(buf, 10, 60);
-        
-        if(debug_x > 0) {
+        char key = Keypad_Get_Key();
+
+        /* --- Parameter editing (one step per key press) --- */
+        if (key != last_key) {
+            uint16_t *v    = tuning_rows[sel].value;
+            uint16_t  step = tuning_rows[sel].step;
+
+            if (key == '#') break;
+            if (key == '2' && sel > 0)                { sel--; dirty = 1; }
+            if (key == '8' && sel < TUNING_ROWS - 1)  { sel++; dirty = 1; }
+            if (key == '4' && *v >= step)             { *v -= step; dirty = 1; }
+            if (key == '6' && *v <= 60000 - step)     { *v += step; dirty = 1; }
+            if (key == '0') { gesture_tuning = gesture_defaults; dirty = 1; }
+        }
+        last_key = key;
+
+        if (dirty) {
+            DrawTuningRows(sel);
+            dirty = 0;
+        }
+
+        /* --- Touch trace inside the pad --- */
+        if (debug_y > PAD_Y0 && debug_y < PAD_Y1) {
             GUI_SetColor(GUI_RED);
             GUI_FillCircle(debug_x, debug_y, 2);
-        } else {
-            GUI_SetColor(GUI_GRAY);
-            GUI_DrawCircle(100, 60, 2); 
         }
 
-        if (Keypad_Get_Key() == '#') break; 
-
         if (dir != SWIPE_NONE) {
+            Gesture_Info_t info;
+
+            Touch_Get_Gesture_Info(&info);
+            GUI_SetBkColor(GUI_BLACK);
+            GUI_ClearRect(1, PAD_Y0 + 1, 238, PAD_Y1 - 1);
+
             GUI_SetColor(GUI_GREEN);
-            GUI_SetFont(GUI_FONT_32B_ASCII);
-            GUI_SetBkColor(GUI_BLACK); 
-            GUI_ClearRect(0, 100, 240, 250); 
-
-            switch(dir) {
-                case SWIPE_UP:    GUI_DispStringHCenterAt("UP", 120, 140); break;
-                case SWIPE_DOWN:  GUI_DispStringHCenterAt("DOWN", 120, 140); break;
-                case SWIPE_LEFT:  GUI_DispStringHCenterAt("LEFT", 120, 140); break;
-                case SWIPE_RIGHT: GUI_DispStringHCenterAt("RIGHT", 120, 140); break;
-                default: break;
-            }
-            
-            for(volatile int i=0; i<4000000; i++); 
-            GUI_ClearRect(0, 100, 240, 250);
+            GUI_SetFont(GUI_FONT_24B_ASCII);
+            GUI_DispStringHCenterAt(Gesture_Name(dir), 120, PAD_Y0 + 20);
+
+            GUI_SetColor(GUI_GRAY);
+            GUI_SetFont(GUI_FONT_13_1);
+            sprintf(buf, "v = %ld, %ld px/s", (long)info.vx, (long)info.vy);
+            GUI_DispStringHCenterAt(buf, 120, PAD_Y0 + 50);
+            shown_tick = osKernelGetTickCount();
+        }
+
+        // Keep the result up for a while without stalling the loop
+        if (shown_tick && (osKernelGetTickCount() - shown_tick) > 1000) {
+            GUI_SetBkColor(GUI_BLACK);
+            GUI_ClearRect(1, PAD_Y0 + 1, 238, PAD_Y1 - 1);
+            shown_tick = 0;
         }
+
+        osDelay(10);
     }
-}
\ No newline at end of file
+}
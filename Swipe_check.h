@@ -1,15 +1,41 @@
 #ifndef SWIPE_CHECK_H
 #define SWIPE_CHECK_H
 
+#include <stdint.h>
+
 typedef enum {
     SWIPE_NONE = 0,
     SWIPE_UP,
     SWIPE_DOWN,
     SWIPE_LEFT,
-    SWIPE_RIGHT
+    SWIPE_RIGHT,
+    SWIPE_TAP,
+    SWIPE_DOUBLE_TAP,
+    SWIPE_LONG_PRESS,
+    SWIPE_DRAG          // Repeated while a slow movement continues
 } Swipe_Dir_t;
 
+// Recognizer thresholds, adjustable at run time
+typedef struct {
+    uint16_t tap_slop;          // px
+    uint16_t tap_max_ms;
+    uint16_t double_tap_ms;
+    uint16_t long_press_ms;
+    uint16_t swipe_max_ms;
+    uint16_t swipe_min_dist;    // px
+    uint16_t swipe_min_speed;   // px/s
+    uint16_t bounce_ms;
+} Gesture_Tuning_t;
+
+typedef struct {
+    int16_t x, y;               // Newest touch position
+    int32_t vx, vy;             // Least-squares velocity, px/s
+} Gesture_Info_t;
+
 // Function Prototype
 void StartSwipeCheck(void);
 Swipe_Dir_t Touch_Update_Swipe(void);
-#endif
\ No newline at end of file
+void Touch_Reset_Swipe(void);
+void Touch_Get_Gesture_Info(Gesture_Info_t *info);
+Gesture_Tuning_t *Touch_Gesture_Tuning(void);
+#endif
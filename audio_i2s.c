@@ -0,0 +1,204 @@
+#include "stm32f4xx.h"
+#include "audio_i2s.h"
+#include "CS42L52.h"
+#include <stddef.h>
+#include <string.h>
+
+/* =========================================================================
+   CONFIGURATION
+   ========================================================================= */
+// CS42L52 on I2S2 (SPI2), adjust to board wiring. MCK is PC6, the pin the
+// old TIM3 clock hack used.
+#define AUDIO_MCK_GPIO          GPIOC
+#define AUDIO_MCK_PIN           6U
+#define AUDIO_PINS_GPIO         GPIOI
+#define AUDIO_WS_PIN            0U
+#define AUDIO_CK_PIN            1U
+#define AUDIO_SD_PIN            3U
+#define AUDIO_GPIO_EN           (RCC_AHB1ENR_GPIOCEN | RCC_AHB1ENR_GPIOIEN)
+#define AUDIO_AF                5U      // AF5 = SPI2/I2S2
+
+// SPI2_TX request: DMA1 stream 4, channel 0
+#define AUDIO_DMA_STREAM        DMA1_Stream4
+#define AUDIO_DMA_IRQn          DMA1_Stream4_IRQn
+#define AUDIO_DMA_IRQ_PRIO      8U      // Below keypad scan and touch INT
+
+#define AUDIO_PLLI2S_TIMEOUT    100000U
+
+/*
+ * PLLI2S settings for a 1 MHz VCO input (25 MHz HSE / PLLM 25) with MCLK
+ * output enabled (MCLK = 256 x Fs). I2SDIV/ODD are derived at run time.
+ */
+typedef struct {
+    uint32_t fs;
+    uint16_t plln;
+    uint8_t  pllr;
+} Audio_Rate_t;
+
+static const Audio_Rate_t audio_rates[] = {
+    {  8000, 256, 5 },
+    { 11025, 429, 4 },
+    { 16000, 213, 4 },
+    { 22050, 429, 4 },
+    { 32000, 426, 4 },
+    { 44100, 271, 6 },
+    { 48000, 258, 3 }
+};
+#define AUDIO_NUM_RATES  (int)(sizeof(audio_rates) / sizeof(audio_rates[0]))
+
+/* Two halves of AUDIO_BLOCK_FRAMES stereo frames: DMA plays one while the
+   render callback fills the other. */
+static int16_t audio_buf[2 * AUDIO_BLOCK_FRAMES * 2];
+
+static Audio_Render_t volatile audio_render;   // NULL: the stream plays silence
+static uint32_t         audio_fs;
+
+static void Audio_PinAF(GPIO_TypeDef *gpio, uint32_t pin) {
+    gpio->MODER   &= ~(3U << (pin * 2U));
+    gpio->MODER   |=  (2U << (pin * 2U));
+    gpio->OSPEEDR |=  (3U << (pin * 2U));       // Very high speed for MCK
+    gpio->PUPDR   &= ~(3U << (pin * 2U));
+    gpio->AFR[pin / 8U] &= ~(0xFU << ((pin % 8U) * 4U));
+    gpio->AFR[pin / 8U] |=  (AUDIO_AF << ((pin % 8U) * 4U));
+}
+
+static int Audio_ClockInit(const Audio_Rate_t *rate) {
+    uint32_t timeout;
+
+    // PLLI2S can only be reprogrammed while it is off
+    RCC->CR &= ~RCC_CR_PLLI2SON;
+    for (timeout = AUDIO_PLLI2S_TIMEOUT; (RCC->CR & RCC_CR_PLLI2SRDY) && timeout; timeout--);
+
+    RCC->PLLI2SCFGR = ((uint32_t)rate->plln << RCC_PLLI2SCFGR_PLLI2SN_Pos) |
+                      ((uint32_t)rate->pllr << RCC_PLLI2SCFGR_PLLI2SR_Pos);
+    RCC->CFGR &= ~RCC_CFGR_I2SSRC;              // I2S clocked from PLLI2S
+    RCC->CR   |=  RCC_CR_PLLI2SON;
+
+    for (timeout = AUDIO_PLLI2S_TIMEOUT; !(RCC->CR & RCC_CR_PLLI2SRDY); timeout--) {
+        if (timeout == 0U) return -1;
+    }
+    return 0;
+}
+
+/* Master transmit, Philips standard, 16-bit data in 16-bit channels */
+static void Audio_I2SInit(const Audio_Rate_t *rate) {
+    // VCO input is 1 MHz: I2SCLK = PLLN / PLLR MHz
+    uint32_t i2sclk = (1000000U * rate->plln) / rate->pllr;
+    // Fs = I2SCLK / (256 * (2 * I2SDIV + ODD)), rounded to the nearest divider
+    uint32_t tmp    = ((i2sclk / 256U) * 10U / rate->fs + 5U) / 10U;
+    uint32_t div    = tmp / 2U;
+    uint32_t odd    = tmp & 1U;
+
+    if (div < 2U) { div = 2U; odd = 0U; }
+    if (div > 0xFFU) div = 0xFFU;
+
+    SPI2->I2SCFGR = 0;
+    SPI2->I2SCFGR = SPI_I2SCFGR_I2SMOD | SPI_I2SCFGR_I2SCFG_1;
+    SPI2->I2SPR   = SPI_I2SPR_MCKOE | (odd << 8) | div;
+    SPI2->CR2     = SPI_CR2_TXDMAEN;
+
+    audio_fs = i2sclk / (256U * (2U * div + odd));
+}
+
+/* Circular half-word transfers from audio_buf into SPI2->DR */
+static void Audio_DMAInit(void) {
+    DMA_Stream_TypeDef *s = AUDIO_DMA_STREAM;
+
+    s->CR &= ~DMA_SxCR_EN;
+    while (s->CR & DMA_SxCR_EN);
+    DMA1->HIFCR = DMA_HIFCR_CTCIF4 | DMA_HIFCR_CHTIF4 | DMA_HIFCR_CTEIF4 |
+                  DMA_HIFCR_CDMEIF4 | DMA_HIFCR_CFEIF4;
+
+    s->PAR  = (uint32_t)&SPI2->DR;
+    s->M0AR = (uint32_t)audio_buf;
+    s->NDTR = sizeof(audio_buf) / sizeof(audio_buf[0]);
+    s->FCR  = DMA_SxFCR_DMDIS | DMA_SxFCR_FTH;  // FIFO on, full threshold
+    s->CR   = (0U << DMA_SxCR_CHSEL_Pos) | DMA_SxCR_PL_1 |
+              DMA_SxCR_MSIZE_0 | DMA_SxCR_PSIZE_0 |
+              DMA_SxCR_MINC | DMA_SxCR_CIRC | DMA_SxCR_DIR_0 |
+              DMA_SxCR_HTIE | DMA_SxCR_TCIE | DMA_SxCR_TEIE;
+
+    NVIC_SetPriority(AUDIO_DMA_IRQn, AUDIO_DMA_IRQ_PRIO);
+    NVIC_EnableIRQ(AUDIO_DMA_IRQn);
+}
+
+static void Audio_Fill(int16_t *half) {
+    Audio_Render_t render = audio_render;
+
+    if (render != NULL) render(half, AUDIO_BLOCK_FRAMES);
+    else                      memset(half, 0, AUDIO_BLOCK_FRAMES * 2U * sizeof(int16_t));
+}
+
+/* Half transfer: DMA moved on to the second half, refill the first */
+void DMA1_Stream4_IRQHandler(void) {
+    uint32_t isr = DMA1->HISR;
+
+    DMA1->HIFCR = isr & (DMA_HISR_TCIF4 | DMA_HISR_HTIF4 | DMA_HISR_TEIF4);
+
+    if (isr & DMA_HISR_HTIF4) Audio_Fill(&audio_buf[0]);
+    if (isr & DMA_HISR_TCIF4) Audio_Fill(&audio_buf[AUDIO_BLOCK_FRAMES * 2U]);
+}
+
+/*
+ * Start the PCM path at the highest table rate not above sample_rate
+ * (8-48 kHz). MCLK runs from then on, so the codec is configured last.
+ * The stream plays silence until Audio_Start hands it a render function.
+ * Returns -1 if PLLI2S does not lock or the codec does not come up; the
+ * stream is stopped again then.
+ */
+int Audio_Init(uint32_t sample_rate) {
+    const Audio_Rate_t *rate = &audio_rates[0];
+
+    for (int i = 1; i < AUDIO_NUM_RATES; i++) {
+        if (audio_rates[i].fs <= sample_rate) rate = &audio_rates[i];
+    }
+
+    Audio_Stop();
+
+    RCC->AHB1ENR |= AUDIO_GPIO_EN | RCC_AHB1ENR_DMA1EN;
+    RCC->APB1ENR |= RCC_APB1ENR_SPI2EN;
+    (void)RCC->APB1ENR;
+
+    Audio_PinAF(AUDIO_MCK_GPIO,  AUDIO_MCK_PIN);
+    Audio_PinAF(AUDIO_PINS_GPIO, AUDIO_WS_PIN);
+    Audio_PinAF(AUDIO_PINS_GPIO, AUDIO_CK_PIN);
+    Audio_PinAF(AUDIO_PINS_GPIO, AUDIO_SD_PIN);
+
+    if (Audio_ClockInit(rate) != 0) return -1;
+    Audio_I2SInit(rate);
+
+    // Both halves hold real samples before the first request
+    Audio_Fill(&audio_buf[0]);
+    Audio_Fill(&audio_buf[AUDIO_BLOCK_FRAMES * 2U]);
+    Audio_DMAInit();
+
+    AUDIO_DMA_STREAM->CR |= DMA_SxCR_EN;
+    SPI2->I2SCFGR |= SPI_I2SCFGR_I2SE;
+
+    if (Codec_Init() != 0) {
+        Audio_Stop();
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Render from the next half-buffer request on. Set up whatever `render`
+ * reads first: it runs in the DMA interrupt from then on.
+ */
+void Audio_Start(Audio_Render_t render) {
+    audio_render = render;
+}
+
+void Audio_Stop(void) {
+    NVIC_DisableIRQ(AUDIO_DMA_IRQn);
+    SPI2->I2SCFGR &= ~SPI_I2SCFGR_I2SE;
+    AUDIO_DMA_STREAM->CR &= ~DMA_SxCR_EN;
+    while (AUDIO_DMA_STREAM->CR & DMA_SxCR_EN);
+    audio_render = NULL;
+}
+
+/* Rate actually produced by the PLLI2S / divider pair */
+uint32_t Audio_GetSampleRate(void) {
+    return audio_fs;
+}
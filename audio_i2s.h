@@ -0,0 +1,18 @@
+#ifndef AUDIO_I2S_H
+#define AUDIO_I2S_H
+
+#include <stdint.h>
+
+// Stereo frames rendered per callback (half of the DMA ring)
+#define AUDIO_BLOCK_FRAMES  256U
+
+/* Fill `frames` interleaved L/R 16-bit frames. Runs in the DMA interrupt:
+   no blocking RTOS calls. */
+typedef void (*Audio_Render_t)(int16_t *buf, uint32_t frames);
+
+int      Audio_Init(uint32_t sample_rate);
+void     Audio_Start(Audio_Render_t render);
+void     Audio_Stop(void);
+uint32_t Audio_GetSampleRate(void);
+
+#endif
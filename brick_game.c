@@ -5,8 +5,11 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h> // For abs()
-#include "input.h"
+#include "game_input.h"
 #include "sound.h"  // <-- sound integration (PB4 beeps)
+#include "music.h"
+#include "compositor.h"
+#include "sprite.h"
 
 /************************************************************
  * BRICK BREAKER  MULTI-LEVEL ENGINE (WITH SOUND)
@@ -26,12 +29,33 @@
 #define BRICK_H         10
 
 #define MAX_LEVELS      3
-#define GAME_SPEED_MS   25
+#define GAME_SPEED_MS   25  // 40 fps frame period
+
+/* "LVL:n  PTS:nnnn" box, cleared before each HUD update */
+#define HUD_X0          2
+#define HUD_Y0          2
+#define HUD_X1          (HUD_X0 + 119)
+#define HUD_Y1          (HUD_Y0 + 12)
 
 typedef struct { int x, y, w, h; } rect_t;
 typedef struct { int x, y, vx, vy; } ball_t;
 typedef struct { rect_t rect; int active; } brick_t;
 
+/* Steering auto-repeats once per frame while held */
+static const Input_KeyBind_t brick_keys[] = {
+    {'4', INPUT_LEFT,    1},
+    {'6', INPUT_RIGHT,   1},
+    {'B', INPUT_RESTART, 0},
+    {'#', INPUT_EXIT,    0}
+};
+
+static const Input_Map_t brick_map = {
+    .keys            = brick_keys,
+    .num_keys        = sizeof(brick_keys) / sizeof(brick_keys[0]),
+    .repeat_delay_ms = GAME_SPEED_MS,
+    .repeat_rate_ms  = GAME_SPEED_MS
+};
+
 /*********** GLOBAL GAME STATE ***********/
 static int screen_w, screen_h;
 static rect_t paddle;
@@ -44,6 +68,15 @@ static int current_level;
 static int game_active;
 static int game_won; // 0 = playing, 1 = lost, 2 = won game
 
+/*********** RENDER STATE ***********/
+// What the panel shows, so a frame only touches what moved or changed
+static int    scene_valid;      // 0 = next draw_scene repaints everything
+static rect_t drawn_ball;
+static rect_t drawn_paddle;
+static int    drawn_brick[BRICK_ROWS][BRICK_COLS];
+static int    drawn_score;
+static int    drawn_level;
+
 /*********** INTERNAL PROTOTYPES ***********/
 static void start_new_game(void);
 static void load_level(int level);
@@ -63,17 +96,27 @@ void StartBrickGame(void)
     screen_h = LCD_GetYSize();
 
     Sound_Init();          // initialize buzzer (PB4)
+    Music_Play(&song_brick);
     start_new_game();
 
+    Input_Begin(&brick_map);    // Drop the menu's 'B' press
+
+    // Frames are paced from their start, so drawing time is not added on top
+    uint32_t next_frame = osKernelGetTickCount();
+
     while (1)
     {
-        /* --- INPUT --- */
-        char key = Keypad_Get_Key();
+        Input_Action_t act;
 
-        if (key == '4')      move_paddle(-1);
-        else if (key == '6') move_paddle(1);
-        else if (key == '#') return;
-        else if (key == 'B') start_new_game(); // Force Restart
+        /* --- INPUT --- */
+        Input_Poll();
+        while (Input_Get(&act))
+        {
+            if (act == INPUT_EXIT) return;
+            if (act == INPUT_RESTART) start_new_game(); // Force Restart
+            if (act == INPUT_LEFT)    move_paddle(-1);
+            if (act == INPUT_RIGHT)   move_paddle(1);
+        }
 
         /* --- LOGIC --- */
         if (game_active) {
@@ -89,19 +132,29 @@ void StartBrickGame(void)
             draw_overlay_message();
             Sound_GameOverBeep();
             // Blocking wait for restart or exit
+            Input_Flush();                      // Drop input from before game over
             while (1) {
-                char k = Keypad_Get_Key();
-                if (k == 'B') {
-                    start_new_game();
-                    break;
+                Input_Poll();
+                if (Input_Get(&act)) {
+                    if (act == INPUT_RESTART) {
+                        start_new_game();
+                        Input_Flush();
+                        next_frame = osKernelGetTickCount();
+                        break;
+                    }
+                    if (act == INPUT_EXIT) return;
+                    continue;
                 }
-                if (k == '#') return;
                 osDelay(50);
             }
         }
         else
         {
-            osDelay(GAME_SPEED_MS);
+            uint32_t now = osKernelGetTickCount();
+
+            next_frame += GAME_SPEED_MS;
+            if ((int32_t)(next_frame - now) > 0) osDelayUntil(next_frame);
+            else next_frame = now;          // Overran (level change): resync
         }
     }
 }
@@ -178,12 +231,13 @@ static void load_level(int level)
     }
 
     // Slight pause before level starts
-    GUI_Clear();
+    scene_valid = 0;
     draw_scene();
     GUI_SetFont(GUI_FONT_20_ASCII);
     GUI_SetColor(GUI_CYAN);
     GUI_DispStringHCenterAt("LEVEL UP", screen_w/2, screen_h/2);
     osDelay(800);
+    scene_valid = 0;    // The first frame of the level clears the banner
 }
 
 /************************************************************
@@ -203,10 +257,7 @@ static void update_physics(void)
     else if (ball.y >= screen_h) {
         game_active = 0;
         game_won = 1; // 1 = Loss
-
-        Sound_GameOverBeep();   // <<< play game-over beep
-
-        return;
+        return;       // Overlay plays the game-over beep
     }
 
     /* Paddle Collision */
@@ -233,9 +284,7 @@ static void update_physics(void)
                             load_level(current_level);
                         } else {
                             game_active = 0;
-                            game_won = 2; // 2 = Victory
-
-                            Sound_GameOverBeep();   // <<< play win beep (same long beep)
+                            game_won = 2; // 2 = Victory (overlay beeps)
                         }
                     }
                     return;
@@ -263,35 +312,134 @@ static int check_collision(rect_t r1, rect_t r2)
             r1.y < r2.y + r2.h && r1.y + r1.h > r2.y);
 }
 
-static void draw_scene(void)
+/* Inclusive box of a rect as the game draws it (x .. x + w) */
+static int boxes_overlap(rect_t a, rect_t b)
+{
+    return (a.x <= b.x + b.w && b.x <= a.x + a.w &&
+            a.y <= b.y + b.h && b.y <= a.y + a.h);
+}
+
+static void fill_box(rect_t b)
+{
+    GUI_FillRect(b.x, b.y, b.x + b.w, b.y + b.h);
+}
+
+/* Sprite (sprite_data.c) when the box has the size it was drawn for,
+   a fill in the current colour otherwise */
+static void draw_box_sprite(rect_t b, const Sprite_t *spr)
+{
+    if (b.w + 1 == spr->w && b.h + 1 == spr->h)
+        Sprite_Draw(spr, b.x, b.y, GUI_BLACK);
+    else
+        fill_box(b);
+}
+
+/* Blank the part of `old` that `now` no longer covers: at most four strips */
+static void erase_uncovered(rect_t old, rect_t now)
+{
+    int ox1 = old.x + old.w, oy1 = old.y + old.h;
+    int nx1 = now.x + now.w, ny1 = now.y + now.h;
+
+    GUI_SetColor(GUI_BLACK);
+    if (!boxes_overlap(old, now)) {
+        fill_box(old);
+        return;
+    }
+    if (now.y > old.y) GUI_FillRect(old.x, old.y, ox1, now.y - 1);
+    if (ny1 < oy1)     GUI_FillRect(old.x, ny1 + 1, ox1, oy1);
+
+    int y0 = (now.y > old.y) ? now.y : old.y;
+    int y1 = (ny1 < oy1) ? ny1 : oy1;
+    if (now.x > old.x) GUI_FillRect(old.x, y0, now.x - 1, y1);
+    if (nx1 < ox1)     GUI_FillRect(nx1 + 1, y0, ox1, y1);
+}
+
+static void draw_brick(int r, int c)
+{
+    // Color based on row
+    GUI_SetColor((r % 2 == 0) ? GUI_GREEN : GUI_YELLOW);
+    draw_box_sprite(bricks[r][c].rect, (r % 2 == 0) ? &spr_brick_green : &spr_brick_yellow);
+}
+
+static void draw_hud(void)
 {
     GUI_SetBkColor(GUI_BLACK);
-    GUI_Clear();
+    GUI_ClearRect(HUD_X0, HUD_Y0, HUD_X1, HUD_Y1);
+    GUI_SetColor(GUI_WHITE);
+    GUI_SetFont(GUI_FONT_13_ASCII);
+    char buf[40];
+    sprintf(buf, "LVL:%d  PTS:%d", current_level, score);
+    GUI_DispStringAt(buf, HUD_X0, HUD_Y0);
+    drawn_score = score;
+    drawn_level = current_level;
+}
 
-    /* Paddle & Ball */
+static void draw_paddle_ball(rect_t ball_box)
+{
     GUI_SetColor(GUI_BLUE);
-    GUI_FillRect(paddle.x, paddle.y, paddle.x + paddle.w, paddle.y + paddle.h);
+    fill_box(paddle);
     GUI_SetColor(GUI_RED);
-    GUI_FillRect(ball.x, ball.y, ball.x + BALL_SIZE, ball.y + BALL_SIZE);
+    draw_box_sprite(ball_box, &spr_ball);
+}
 
-    /* Bricks */
+/* Whole frame, called once per band by the compositor */
+static void draw_full_cb(void *p)
+{
+    GUI_SetBkColor(GUI_BLACK);
+    GUI_Clear();
     for (int r = 0; r < BRICK_ROWS; r++) {
         for (int c = 0; c < BRICK_COLS; c++) {
-            if (bricks[r][c].active) {
-                // Color based on row
-                GUI_SetColor((r % 2 == 0) ? GUI_GREEN : GUI_YELLOW);
-                rect_t b = bricks[r][c].rect;
-                GUI_FillRect(b.x, b.y, b.x + b.w, b.y + b.h);
+            if (bricks[r][c].active) draw_brick(r, c);
+        }
+    }
+    draw_hud();
+    draw_paddle_ball(*(const rect_t *)p);
+}
+
+/*
+ * Full frame on a new level or after an overlay (banded, see compositor.c).
+ * Otherwise: the strips the ball and paddle left, bricks that were just
+ * destroyed, anything the old ball box overlapped, and the HUD when score
+ * or level changed.
+ */
+static void draw_scene(void)
+{
+    rect_t ball_box = { ball.x, ball.y, BALL_SIZE, BALL_SIZE };
+    rect_t hud_box  = { HUD_X0, HUD_Y0, HUD_X1 - HUD_X0, HUD_Y1 - HUD_Y0 };
+    int hud = (score != drawn_score) || (current_level != drawn_level);
+
+    GUI_SetBkColor(GUI_BLACK);
+
+    if (!scene_valid) {
+        Compositor_Draw(NULL, draw_full_cb, &ball_box);
+        for (int r = 0; r < BRICK_ROWS; r++)
+            for (int c = 0; c < BRICK_COLS; c++)
+                drawn_brick[r][c] = bricks[r][c].active;
+    } else {
+        erase_uncovered(drawn_ball, ball_box);
+        erase_uncovered(drawn_paddle, paddle);
+
+        /* Bricks */
+        for (int r = 0; r < BRICK_ROWS; r++) {
+            for (int c = 0; c < BRICK_COLS; c++) {
+                if (drawn_brick[r][c] && !bricks[r][c].active) {
+                    GUI_SetColor(GUI_BLACK);
+                    fill_box(bricks[r][c].rect);
+                    drawn_brick[r][c] = 0;
+                } else if (drawn_brick[r][c] && boxes_overlap(drawn_ball, bricks[r][c].rect)) {
+                    draw_brick(r, c);       // Edge grazed by the erased ball
+                }
             }
         }
+        if (boxes_overlap(drawn_ball, hud_box)) hud = 1;
+
+        if (hud) draw_hud();
+        draw_paddle_ball(ball_box);
     }
 
-    /* HUD */
-    GUI_SetColor(GUI_WHITE);
-    GUI_SetFont(GUI_FONT_13_ASCII);
-    char buf[40];
-    sprintf(buf, "LVL:%d  PTS:%d", current_level, score);
-    GUI_DispStringAt(buf, 2, 2);
+    drawn_ball   = ball_box;
+    drawn_paddle = paddle;
+    scene_valid  = 1;
 }
 
 static void draw_overlay_message(void)
@@ -1,76 +1,140 @@
 #include "stm32f4xx.h"
-#include "Driver_I2C.h"
+#include "i2c_bus.h"
 #include "CS42L52.h"
 
 #define CODEC_I2C_ADDR 0x4A  // 
 
-extern ARM_DRIVER_I2C Driver_I2C1; // Reuse the I2C driver from Touchscreen
+// Unchanged registers a run may carry instead of starting a new transfer
+#define CODEC_RUN_BRIDGE    2U
+
+typedef struct {
+    uint8_t reg;
+    uint8_t val;
+} Codec_RegVal_t;
 
 // -----------------------------------------------------------
-// 1. Low-Level I2C Functions (Reused from Touchscreen logic)
+// 1. Register Shadow (queued on the shared I2C1 bus manager)
 // -----------------------------------------------------------
-static void Codec_Write(uint8_t reg, uint8_t val) {
-    uint8_t data[2] = {reg, val};
-    Driver_I2C1.MasterTransmit(CODEC_I2C_ADDR, data, 2, false);
-    while(Driver_I2C1.GetStatus().busy); // Blocking wait 
+// Last value written to (or read from) each register. A write that
+// matches the shadow never reaches the bus.
+static uint8_t  codec_shadow[CS42L52_REG_LAST + 1];
+static uint64_t codec_valid;                    // Bit per register: shadow is known
+
+// Writes here have side effects even with an unchanged value
+static const uint64_t codec_trigger = (1ULL << CS42L52_BEEP_TONE_CTL);
+
+static int Codec_IsCached(uint8_t reg, uint8_t val) {
+    uint64_t bit = 1ULL << reg;
+
+    return (codec_valid & bit) && !(codec_trigger & bit) && (codec_shadow[reg] == val);
+}
+
+/*
+ * Write n consecutive registers starting at reg. Unchanged registers are
+ * dropped; what is left goes out as auto-increment runs, bridging short
+ * gaps so the bus sees as few transfers as possible. Non-blocking.
+ */
+static void Codec_WriteRegs(uint8_t reg, const uint8_t *vals, uint32_t n) {
+    uint32_t i = 0;
+
+    if ((reg + n) > (CS42L52_REG_LAST + 1U)) return;
+
+    while (i < n) {
+        // Start of the next run: first register that needs writing
+        while ((i < n) && Codec_IsCached((uint8_t)(reg + i), vals[i])) i++;
+        if (i >= n) break;
+
+        uint32_t start = i;
+        uint32_t end   = i + 1U;                // One past the last changed register
+
+        for (uint32_t j = end; (j < n) && (j <= end + CODEC_RUN_BRIDGE); j++) {
+            if (!Codec_IsCached((uint8_t)(reg + j), vals[j])) end = j + 1U;
+        }
+
+        I2C_Bus_WriteRegs(CODEC_I2C_ADDR, (uint8_t)(reg + start), &vals[start], end - start,
+                          I2C_BUS_PRIO_CODEC, CS42L52_MAP_INCR);
+        for (uint32_t j = start; j < end; j++) codec_shadow[reg + j] = vals[j];
+        codec_valid |= ((1ULL << (end - start)) - 1ULL) << (reg + start);
+        i = end;
+    }
+}
+
+/* Apply a sequence in order; neighbours with consecutive addresses share a run */
+static void Codec_WriteTable(const Codec_RegVal_t *tbl, uint32_t n) {
+    uint8_t vals[CS42L52_REG_LAST + 1];
+    uint32_t i = 0;
+
+    while (i < n) {
+        uint32_t len = 0;
+
+        do {
+            vals[len++] = tbl[i++].val;
+        } while ((i < n) && (tbl[i].reg == (uint8_t)(tbl[i - 1U].reg + 1U)));
+
+        Codec_WriteRegs(tbl[i - len].reg, vals, len);
+    }
+}
+
+/* Seed the shadow with the codec's own register file (one burst read).
+   Returns -1 if the codec does not answer. */
+static int Codec_LoadShadow(void) {
+    uint8_t map = 0x01 | CS42L52_MAP_INCR;
+
+    if (I2C_Bus_Transfer(CODEC_I2C_ADDR, &map, 1, &codec_shadow[1], CS42L52_REG_LAST,
+                         I2C_BUS_PRIO_CODEC) == 0) {
+        codec_valid = ((1ULL << CS42L52_REG_LAST) - 1ULL) << 1;
+        return 0;
+    }
+    codec_valid = 0;            // Unknown: the first write of each register goes out
+    return -1;
 }
 
 // -----------------------------------------------------------
-// 2. Master Clock (MCLK) Generation using TIM3 on PC6
+// 2. Master Clock (MCLK)
 // -----------------------------------------------------------
-void MCLK_Init(void) {
-    // Enable TIM3 and GPIOC clocks
-    RCC->APB1ENR |= RCC_APB1ENR_TIM3EN; 
-    RCC->AHB1ENR |= RCC_AHB1ENR_GPIOCEN;
-
-    // Configure PC6 as Alternate Function (AF2) for TIM3
-    GPIOC->MODER &= ~(3U << (6 * 2));
-    GPIOC->MODER |=  (2U << (6 * 2)); // AF Mode
-    GPIOC->AFR[0] &= ~(0xF << (6 * 4));
-    GPIOC->AFR[0] |=  (2U << (6 * 4)); // AF2
-
-    // Configure TIM3 for PWM generation (~12MHz required)
-    // Settings based on SystemCoreClock 168MHz to get correct MCLK
-    TIM3->CCMR1 = 0x60;       // PWM Mode 1
-    TIM3->ARR   = 1;          // Auto-reload
-    TIM3->CCR1  = 1;          // 50% Duty Cycle
-    TIM3->CCER  |= 1;         // Enable Capture/Compare 1
-    TIM3->CR1   |= 1;         // Enable Timer 
-}
+// MCLK (256 x Fs) comes from the I2S2 peripheral on PC6, clocked by
+// PLLI2S. Audio_Init (audio_i2s.c) starts it and then calls Codec_Init.
 
 // -----------------------------------------------------------
 // 3. Codec Initialization Sequence
 // -----------------------------------------------------------
-void Codec_Init(void) {
-    // 1. Generate MCLK first (Required for Codec internal logic)
-    MCLK_Init(); 
-
-    // 2. Power Down Codec during config
-    Codec_Write(CS42L52_PWRCTL1, 0x99); 
-    
-    // 3. Configure Interface 
-    // 0x80 = I2S Slave Mode (Beep Gen only needs this)
-    Codec_Write(CS42L52_IFACE_CTL1, 0x80); 
-    
-    // 4. Set Volume (0x00 is 0dB/Max, 0x18 is +12dB)
-    Codec_Write(CS42L52_MASTERA_VOL, 0x00); 
-    
-    // 5. Power Up
-    Codec_Write(CS42L52_PWRCTL1, 0x00); // [cite: 1705]
+static const Codec_RegVal_t codec_init_seq[] = {
+    { CS42L52_PWRCTL1,      0x99 },     // Power Down Codec during config
+    { CS42L52_PWRCTL3,      0xAA },     // Headphone and speaker outputs always on
+    { CS42L52_CLK_CTL,      0x80 },     // Speed and MCLK/LRCK ratio auto-detected
+    { CS42L52_IFACE_CTL1,   0x04 },     // Slave, DAC in I2S format (STM32 is the I2S master)
+    { CS42L52_MASTERA_VOL,  0x00 },     // 0x00 is 0dB/Max, 0x18 is +12dB
+    { CS42L52_PWRCTL1,      0x00 }      // Power Up [cite: 1705]
+};
+
+/*
+ * Returns -1 if the codec does not answer on I2C1 or is not a CS42L52;
+ * nothing is written to it then.
+ */
+int Codec_Init(void) {
+    I2C_Bus_Init();
+
+    // MCLK must already be running (Required for Codec internal logic)
+    if (Codec_LoadShadow() != 0) return -1;
+    if ((codec_shadow[CS42L52_CHIP_ID] & CS42L52_CHIP_ID_MASK) != CS42L52_CHIP_ID_VAL) return -1;
+
+    Codec_WriteTable(codec_init_seq, sizeof(codec_init_seq) / sizeof(codec_init_seq[0]));
+    return 0;
 }
 
 // -----------------------------------------------------------
 // 4. Beep Function
 // -----------------------------------------------------------
 void Codec_Beep(uint8_t pitch, uint8_t duration) {
-    // Set Volume for Beep
-    Codec_Write(CS42L52_BEEP_VOL, 0x06); // -6dB
-    
-    // Set Frequency and Duration
-    Codec_Write(CS42L52_BEEP_FREQ, pitch | duration);
-    
-    // Trigger Single Beep
-    Codec_Write(CS42L52_BEEP_TONE_CTL, 0x40);
-    
+    // BEEP_FREQ (0x1C), BEEP_VOL (0x1D), BEEP_TONE_CTL (0x1E): frequency and
+    // volume only go out when they change, the trigger always does
+    const uint8_t vals[3] = {
+        pitch | duration,   // Set Frequency and Duration
+        0x06,               // Set Volume for Beep: -6dB
+        0x40                // Trigger Single Beep
+    };
+
+    Codec_WriteRegs(CS42L52_BEEP_FREQ, vals, 3);
+
     // Note: To stop/reset, you would write 0x00 to TONE_CTL [cite: 1707]
-}
\ No newline at end of file
+}
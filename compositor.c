@@ -0,0 +1,79 @@
+#include "compositor.h"
+#include "LCD.h"
+#include <stddef.h>
+
+/*
+ * Flicker-free full-scene redraws within the 64 KB emWin heap (GUIConf.c).
+ * A 240x320 RGB565 frame needs 150 KB, so the scene is rendered band by
+ * band: GUI_MEMDEV_Draw calls the draw function once per band with the
+ * clip set to it, then copies the band to the panel in one window write.
+ * The panel never shows a cleared-but-not-redrawn frame.
+ */
+#define COMPOSITOR_BPP  2       // GUICC_565: memory devices match the panel
+
+static int comp_enabled = 1;
+static int comp_active;         // Inside GUI_MEMDEV_Draw: drawing goes to a band device
+
+/* Tallest band the free heap holds, 0 when banding is not worthwhile */
+int Compositor_BandLines(int width, int height)
+{
+    U32 free_bytes = GUI_ALLOC_GetNumFreeBytes();
+    int lines;
+
+    if ((width <= 0) || (height <= 0) || (free_bytes <= COMPOSITOR_RESERVE)) return 0;
+
+    lines = (int)((free_bytes - COMPOSITOR_RESERVE) / ((U32)width * COMPOSITOR_BPP));
+    if (lines > height) lines = height;
+    if (lines < COMPOSITOR_MIN_LINES) return 0;
+
+    // Even bands: the last one is not a sliver
+    int bands = (height + lines - 1) / lines;
+    return (height + bands - 1) / bands;
+}
+
+/*
+ * Draw a scene into `area` (NULL = whole screen) through memory-device
+ * bands. Falls back to drawing straight to the panel when disabled or
+ * short of heap. Returns 1 if the scene went through the bands.
+ */
+int Compositor_Draw(const GUI_RECT *area, Compositor_Draw_t *draw, void *data)
+{
+    GUI_RECT r;
+    int lines;
+
+    if (draw == NULL) return 0;
+
+    if (area != NULL) {
+        r = *area;
+    } else {
+        r.x0 = 0;
+        r.y0 = 0;
+        r.x1 = LCD_GetXSize() - 1;
+        r.y1 = LCD_GetYSize() - 1;
+    }
+
+    lines = comp_enabled ? Compositor_BandLines(r.x1 - r.x0 + 1, r.y1 - r.y0 + 1) : 0;
+    if (lines > 0) {
+        // If a band device cannot be created after all, emWin draws direct itself
+        comp_active = 1;
+        int ok = GUI_MEMDEV_Draw(&r, draw, data, lines, 0) == 0;
+        comp_active = 0;
+        return ok;
+    }
+
+    draw(data);
+    return 0;
+}
+
+/* Global switch, e.g. to compare against direct drawing */
+void Compositor_Enable(int on)
+{
+    comp_enabled = on;
+}
+
+/* 1 while a draw function runs for a band: code that writes the panel
+   itself (sprite.c) must go through emWin instead */
+int Compositor_Active(void)
+{
+    return comp_active;
+}
@@ -0,0 +1,18 @@
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include "GUI.h"
+
+/* Redraws a whole scene once per band, into a memory device */
+typedef void Compositor_Draw_t(void *data);
+
+// Band limits: fewer lines than the minimum is not worth it, draw direct
+#define COMPOSITOR_MIN_LINES    8
+#define COMPOSITOR_RESERVE      (4U * 1024U)    // emWin heap left for fonts, strings, etc.
+
+int  Compositor_Draw(const GUI_RECT *area, Compositor_Draw_t *draw, void *data);
+int  Compositor_BandLines(int width, int height);
+void Compositor_Enable(int on);
+int  Compositor_Active(void);
+
+#endif
@@ -6,6 +6,8 @@
 #include "flappy_game.h"
 #include "2048_game.h"
 #include "Swipe_check.h"
+#include "touch_cal.h"
+#include "music.h"
 #include <stdio.h> 
 
 /* ==========================================
@@ -28,6 +30,12 @@ void DrawMainMenu(void) {
     GUI_DispStringHCenterAt("C: FLAPPY", 120, 142);
     GUI_DispStringHCenterAt("D: 2048", 120, 202);
 	GUI_DispStringHCenterAt("*: GESTURE", 120, 262);
+
+    GUI_SetFont(GUI_FONT_13_1);
+    GUI_DispStringHCenterAt("0: TOUCH CALIBRATION", 120, 300);
+
+    // Back on the menu: its own loop replaces the game's track
+    Music_Play(&song_menu);
 }
 
 #define APP_MAIN_STK_SZ (1024U)
@@ -40,6 +48,7 @@ const osThreadAttr_t app_main_attr = {
 __NO_RETURN void app_main (void *argument) {
   int16_t tX = 0, tY = 0;
   char buf[30];
+  Touch_Event_t ev[8];
 
   (void)argument;
 
@@ -61,7 +70,17 @@ __NO_RETURN void app_main (void *argument) {
   while (1) {
     /* Get Inputs using the abstraction in input.c */
     char key = Keypad_Get_Key();
-    int isTouched = Touch_GetCoord(&tX, &tY);
+    int isTouched = 0;
+
+    /* A menu zone is chosen by a finger going down, not by one resting there */
+    int n = Touch_PollEvents(ev, 8);
+    for (int i = 0; i < n; i++) {
+        if (ev[i].type == TOUCH_EVT_DOWN) {
+            isTouched = 1;
+            tX = ev[i].x;
+            tY = ev[i].y;
+        }
+    }
 
     /* --- DEBUG: View Coords --- */
     if (isTouched) {
@@ -78,31 +97,37 @@ __NO_RETURN void app_main (void *argument) {
     if (key == 'A' || (isTouched && tY < 60)) {
         StartSnakeGame();
         DrawMainMenu();
-        // Clear any touch that happened during game exit
-        while(Touch_GetCoord(&tX, &tY)); 
+        // Drop any touch that happened during game exit
+        Touch_FlushEvents();
     }
     // Zone 2: Middle-Top (Brick)
     else if (key == 'B' || (isTouched && tY >= 60 && tY < 120)) {
         StartBrickGame();
         DrawMainMenu();
-        while(Touch_GetCoord(&tX, &tY));
+        Touch_FlushEvents();
     }
     // Zone 3: Middle-Bottom (Flappy)
     else if (key == 'C' || (isTouched && tY >= 120 && tY < 180)) {
         StartFlappyGame();
         DrawMainMenu();
-        while(Touch_GetCoord(&tX, &tY));
+        Touch_FlushEvents();
     }
     // Zone 4: Bottom (2048)
     else if (key == 'D' || (isTouched && tY >= 180 && tY < 240)) {
         Start2048Game();
         DrawMainMenu();
-        while(Touch_GetCoord(&tX, &tY));
+        Touch_FlushEvents();
     }
 		 else if (key == '*' || (isTouched && tY >= 240)) {
         StartSwipeCheck();
         DrawMainMenu();
-        while(Touch_GetCoord(&tX, &tY));
+        Touch_FlushEvents();
+    }
+    // Keypad only: the touch map may be the thing that is off
+    else if (key == '0') {
+        StartTouchCalibration();
+        DrawMainMenu();
+        Touch_FlushEvents();
     }
 
     GUI_Delay(50);
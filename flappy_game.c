@@ -5,8 +5,12 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h> 
-#include "input.h" // <--- Now includes Touch_GetCoord
+#include "game_input.h" // Keypad + touch -> logical actions
 #include "sound.h"
+#include "music.h"
+#include "lcd_scroll.h"
+#include "compositor.h"
+#include "sprite.h"
 /************************************************************
  * FLAPPY BIRD  STANDALONE ENGINE
  ************************************************************/
@@ -28,6 +32,15 @@
 
 #define GROUND_H        10     
 #define GAME_SPEED_MS   40     
+#define SKY_COLOR       0x00FFFF00
+
+/* --- HARDWARE SCROLL MODE --- */
+// 1: landscape play along the panel's 320-line axis (board held with its
+// top edge to the left). The controller's scroll window moves the world,
+// so a frame only draws the newly exposed columns and the bird.
+// 0: portrait play with a full redraw per frame.
+#define FLAPPY_HW_SCROLL    1
+#define SCROLL_HUD_LINES    40      // Fixed top area (TFA) holding the score
 
 typedef struct {
     int y;
@@ -40,6 +53,19 @@ typedef struct {
     int active;
 } pipe_t;
 
+/* A jump is key '5' or any finger going down on the panel */
+static const Input_KeyBind_t flappy_keys[] = {
+    {'5', INPUT_ACTION,  0},
+    {'C', INPUT_RESTART, 0},
+    {'#', INPUT_EXIT,    0}
+};
+
+static const Input_Map_t flappy_map = {
+    .keys       = flappy_keys,
+    .num_keys   = sizeof(flappy_keys) / sizeof(flappy_keys[0]),
+    .touch_down = INPUT_ACTION
+};
+
 /*********** GLOBAL GAME STATE ***********/
 static int screen_w, screen_h;
 static bird_t bird;
@@ -48,6 +74,16 @@ static int score;
 static int game_active;
 static int high_score = 0;
 
+#if FLAPPY_HW_SCROLL
+/*********** SCROLL STATE ***********/
+// Game x runs along the scroll area's lines, game y along panel x (mirrored)
+static int scroll_pos;      // Ring offset of game x = 0, 0..screen_w-1
+static int drawn_pos;       // scroll_pos of the last drawn frame
+static int drawn_bird_y;
+static int drawn_score;
+static int scene_valid;     // 0 = next draw_scene repaints everything
+#endif
+
 /*********** INTERNAL PROTOTYPES ***********/
 static void init_game(void);
 static void draw_scene(void);
@@ -55,6 +91,7 @@ static void update_physics(void);
 static void spawn_pipe(int index, int start_x);
 static int  check_collision(void);
 static void game_over_screen(void);
+static void leave_game(void);
 
 /************************************************************
  * PUBLIC FUNCTION  ENTRY POINT
@@ -62,44 +99,44 @@ static void game_over_screen(void);
 void StartFlappyGame(void)
 {
     GUI_Clear();
+#if FLAPPY_HW_SCROLL
+    screen_w = LCD_GetYSize() - SCROLL_HUD_LINES;   // Scrolling axis
+    screen_h = LCD_GetXSize();
+    LCD_X_SetScrollArea(SCROLL_HUD_LINES, screen_w, 0);
+#else
     screen_w = LCD_GetXSize();
     screen_h = LCD_GetYSize();
-
-    // --- TOUCH VARIABLES ---
-    int16_t tX, tY;
-    int is_touched = 0;
-    int prev_touched = 0; // Needed to detect single taps
+#endif
 
     init_game();
+    Music_Play(&song_flappy);
+    Input_Begin(&flappy_map);
 
     while (1)
     {
+        Input_Action_t act;
+
         /* ------------------------------
          * INPUT CONTROL
          * ------------------------------ */
-        char key = Keypad_Get_Key();
-        
-        // 1. Poll Touch Sensor
-        is_touched = Touch_GetCoord(&tX, &tY);
-
-        /* Jump Controls (Key '5' OR Touch Tap) */
-        if (game_active) {
-            // Check for Key '5' OR (Touch  is active AND it wasn't active last frame)
-            if (key == '5' || (is_touched)) {
+        Input_Poll();
+        while (Input_Get(&act))
+        {
+            /* Jump Controls (Key '5' OR Touch Tap) */
+            if (act == INPUT_ACTION && game_active) {
                 bird.vel_y = JUMP_FORCE;
             }
-        }
-        
-        // Update history for next frame (Edge Detection)
-        prev_touched = is_touched;
 
-        /* Exit */
-        if (key == '#') return;
+            /* Exit */
+            if (act == INPUT_EXIT) { leave_game(); return; }
 
-        /* Force Restart (In-game) */
-        if (key == 'C') {
-            init_game();
-            osDelay(200);
+            /* Force Restart (In-game) */
+            if (act == INPUT_RESTART) {
+                init_game();
+                osDelay(200);
+                Input_Flush();
+                break;
+            }
         }
 
         /* ------------------------------
@@ -122,26 +159,22 @@ void StartFlappyGame(void)
             // 1. Small delay so we don't accidentally restart instantly
             osDelay(500);
             
-            // 2. Clear any lingering touch input
-            while(Touch_GetCoord(&tX, &tY));
+            // 2. Drop input that happened before the overlay
+            Input_Flush();
 
             // 3. Wait for new input
             while (1) {
-                char k = Keypad_Get_Key();
-                
-                // Restart on Touch
-                if (Touch_GetCoord(&tX, &tY)) {
-                     init_game();
-                     osDelay(200);
-                     break;
+                Input_Poll();
+                if (Input_Get(&act)) {
+                    if (act == INPUT_EXIT) { leave_game(); return; }
+                    if (act == INPUT_RESTART || act == INPUT_ACTION) {
+                        init_game();
+                        osDelay(200);
+                        Input_Flush();
+                        break;
+                    }
+                    continue;
                 }
-
-                if (k == 'C') {
-                    init_game();
-                    osDelay(200);
-                    break;
-                }
-                if (k == '#') return;
                 osDelay(50);
             }
         }
@@ -152,6 +185,14 @@ void StartFlappyGame(void)
     }
 }
 
+/* The menu expects an unscrolled panel */
+static void leave_game(void)
+{
+#if FLAPPY_HW_SCROLL
+    LCD_X_SetScrollArea(0, LCD_SCROLL_LINES, 0);
+#endif
+}
+
 /************************************************************
  * INITIALIZE GAME
  ************************************************************/
@@ -159,6 +200,10 @@ static void init_game(void)
 {
     score = 0;
     game_active = 1;
+#if FLAPPY_HW_SCROLL
+    scroll_pos  = 0;
+    scene_valid = 0;
+#endif
 
     /* Reset Bird */
     bird.y = screen_h / 2;
@@ -217,6 +262,9 @@ static void update_physics(void)
             score++;
         }
     }
+#if FLAPPY_HW_SCROLL
+    scroll_pos = (scroll_pos + PIPE_SPEED) % screen_w;
+#endif
 
     /* 3. Check Collisions */
     if (check_collision())
@@ -260,8 +308,183 @@ static int check_collision(void)
 /************************************************************
  * DRAWING
  ************************************************************/
+#if FLAPPY_HW_SCROLL
+/* GRAM line holding game column x at the current scroll position */
+static int scroll_line(int x)
+{
+    return SCROLL_HUD_LINES + (scroll_pos + x) % screen_w;
+}
+
+/* Fill a game rect (inclusive), clipped to the play area and split
+   where it crosses the end of the scroll ring */
+static void fill_play(int x0, int y0, int x1, int y1)
+{
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > screen_w - 1) x1 = screen_w - 1;
+    if (y1 > screen_h - 1) y1 = screen_h - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    int px0 = screen_h - 1 - y1;
+    int px1 = screen_h - 1 - y0;
+    int l0  = scroll_line(x0);
+    int l1  = scroll_line(x1);
+
+    if (l0 <= l1) {
+        GUI_FillRect(px0, l0, px1, l1);
+    } else {
+        GUI_FillRect(px0, l0, px1, SCROLL_HUD_LINES + screen_w - 1);
+        GUI_FillRect(px0, SCROLL_HUD_LINES, px1, l1);
+    }
+}
+
+static void fill_clip(int x0, int y0, int x1, int y1, const GUI_RECT *c)
+{
+    fill_play(x0 > c->x0 ? x0 : c->x0, y0 > c->y0 ? y0 : c->y0,
+              x1 < c->x1 ? x1 : c->x1, y1 < c->y1 ? y1 : c->y1);
+}
+
+/* Sky, pipes and ground inside one game rect, in the classic draw order */
+static void draw_world(int x0, int y0, int x1, int y1)
+{
+    GUI_RECT c = { x0, y0, x1, y1 };
+
+    GUI_SetColor(SKY_COLOR);
+    fill_play(x0, y0, x1, y1);
+
+    for (int i = 0; i < NUM_PIPES; i++)
+    {
+        int px = pipes[i].x;
+        int gy = pipes[i].gap_y;
+        int by = gy + PIPE_GAP_H;
+
+        if (px > x1 || px + PIPE_WIDTH < x0) continue;
+
+        /* Outline, then the green inside */
+        GUI_SetColor(GUI_BLACK);
+        fill_clip(px, 0, px + PIPE_WIDTH, gy, &c);
+        fill_clip(px, by, px + PIPE_WIDTH, screen_h - GROUND_H, &c);
+        GUI_SetColor(GUI_GREEN);
+        fill_clip(px + 1, 1, px + PIPE_WIDTH - 1, gy - 1, &c);
+        fill_clip(px + 1, by + 1, px + PIPE_WIDTH - 1, screen_h - GROUND_H - 1, &c);
+    }
+
+    GUI_SetColor(GUI_BROWN);
+    fill_clip(0, screen_h - GROUND_H, screen_w, screen_h, &c);
+}
+
+/* The bird sprite is stored turned for the panel (spr_bird_cw). Like
+   fill_play, it is split where it crosses the end of the scroll ring. */
+static void draw_bird(void)
+{
+    GUI_RECT ring = { 0, SCROLL_HUD_LINES, screen_h - 1, SCROLL_HUD_LINES + screen_w - 1 };
+    int px = screen_h - 1 - (bird.y + BIRD_SIZE);
+    int l0 = scroll_line(BIRD_X_POS);
+
+    Sprite_DrawClip(&spr_bird_cw, px, l0, SKY_COLOR, &ring);
+    if (l0 + BIRD_SIZE > ring.y1)
+        Sprite_DrawClip(&spr_bird_cw, px, l0 - screen_w, SKY_COLOR, &ring);
+    drawn_bird_y = bird.y;
+}
+
+/* Text centred in a game rect, reading along the scroll axis */
+static void draw_play_text(const char *s, int x0, int y0, int x1, int y1)
+{
+    GUI_RECT r = { screen_h - 1 - y1, scroll_line(x0), screen_h - 1 - y0, scroll_line(x1) };
+
+    GUI_DispStringInRectEx(s, &r, GUI_TA_HCENTER | GUI_TA_VCENTER, -1, GUI_ROTATE_CW);
+}
+
+/* Score lives in the fixed area, which never scrolls */
+static void draw_score(void)
+{
+    GUI_RECT r = { 0, 0, screen_h - 1, SCROLL_HUD_LINES - 1 };
+    char buf[16];
+
+    GUI_SetBkColor(SKY_COLOR);
+    GUI_ClearRect(r.x0, r.y0, r.x1, r.y1);
+    GUI_SetColor(GUI_BLACK);
+    GUI_SetFont(GUI_FONT_20_ASCII);
+    sprintf(buf, "%d", score);
+    GUI_DispStringInRectEx(buf, &r, GUI_TA_HCENTER | GUI_TA_VCENTER, -1, GUI_ROTATE_CW);
+    drawn_score = score;
+}
+
+/*
+ * Per frame: move the scroll start, repaint the world where the bird was,
+ * paint the columns that came in on the right (they reuse the lines that
+ * just left on the left) and the bird. The score only when it changed.
+ */
 static void draw_scene(void)
 {
+    if (!scene_valid)
+    {
+        LCD_X_SetScrollStart(scroll_line(0));
+        draw_world(0, 0, screen_w - 1, screen_h - 1);
+        draw_score();
+        draw_bird();
+        drawn_pos   = scroll_pos;
+        scene_valid = 1;
+        return;
+    }
+
+    int moved = (scroll_pos - drawn_pos + screen_w) % screen_w;
+
+    LCD_X_SetScrollStart(scroll_line(0));
+
+    /* The bird stays put on screen, so the world moved out from under it */
+    draw_world(BIRD_X_POS - moved, drawn_bird_y,
+               BIRD_X_POS - moved + BIRD_SIZE, drawn_bird_y + BIRD_SIZE);
+    if (moved > 0)
+        draw_world(screen_w - moved, 0, screen_w - 1, screen_h - 1);
+
+    draw_bird();
+    if (score != drawn_score) draw_score();
+    drawn_pos = scroll_pos;
+}
+
+static void game_over_screen(void)
+{
+    /* Overlay box */
+    int box_w = 120;
+    int box_h = 80;
+    int box_x = (screen_w - box_w) / 2;
+    int box_y = (screen_h - box_h) / 2;
+    char buf[32];
+
+    // Rotated text needs unbroken lines: redraw once with the ring unwrapped
+    scroll_pos  = 0;
+    scene_valid = 0;
+    draw_scene();
+
+    GUI_SetColor(GUI_BLACK);
+    fill_play(box_x, box_y, box_x + box_w, box_y + box_h);
+    GUI_SetColor(GUI_WHITE);
+    fill_play(box_x + 1, box_y + 1, box_x + box_w - 1, box_y + box_h - 1);
+
+    /* Text */
+    GUI_SetBkColor(GUI_WHITE);
+    GUI_SetColor(GUI_RED);
+    GUI_SetFont(GUI_FONT_20_ASCII);
+    draw_play_text("GAME OVER", box_x, box_y + 10, box_x + box_w, box_y + 30);
+
+    GUI_SetColor(GUI_BLACK);
+    GUI_SetFont(GUI_FONT_13_ASCII);
+
+    sprintf(buf, "Score: %d", score);
+    draw_play_text(buf, box_x, box_y + 35, box_x + box_w, box_y + 48);
+
+    sprintf(buf, "High: %d", high_score);
+    draw_play_text(buf, box_x, box_y + 50, box_x + box_w, box_y + 63);
+
+    draw_play_text("Tap to Restart", box_x, box_y + 65, box_x + box_w, box_y + 78);
+}
+
+#else
+static void draw_scene_cb(void *p)
+{
+    (void)p;
+
     /* 1. Clear Background */
     // Note: Ensure this color format matches your LCD config (e.g. RGB565 vs ARGB8888)
     // If screen is black, try GUI_LIGHTBLUE instead
@@ -291,13 +514,8 @@ static void draw_scene(void)
     GUI_SetColor(GUI_BROWN);
     GUI_FillRect(0, screen_h - GROUND_H, screen_w, screen_h);
 
-    /* 4. Draw Bird (Yellow) */
-    GUI_SetColor(GUI_YELLOW);
-    GUI_FillRect(BIRD_X_POS, bird.y, BIRD_X_POS + BIRD_SIZE, bird.y + BIRD_SIZE);
-    
-    /* Bird Eye */
-    GUI_SetColor(GUI_BLACK);
-    GUI_DrawPixel(BIRD_X_POS + BIRD_SIZE - 2, bird.y + 2);
+    /* 4. Draw Bird (sprite_data.c) */
+    Sprite_Draw(&spr_bird, BIRD_X_POS, bird.y, SKY_COLOR);
 
     /* 5. Draw Score */
     GUI_SetColor(GUI_BLACK); 
@@ -307,6 +525,13 @@ static void draw_scene(void)
     GUI_DispStringHCenterAt(buf, screen_w / 2, 10);
 }
 
+/* Every frame is a full redraw: composite it in bands (compositor.c) so
+   the cleared sky never reaches the panel */
+static void draw_scene(void)
+{
+    Compositor_Draw(NULL, draw_scene_cb, NULL);
+}
+
 static void game_over_screen(void)
 {
     /* Overlay box */
@@ -337,4 +562,5 @@ static void game_over_screen(void)
     GUI_DispStringHCenterAt(buf, screen_w / 2, box_y + 50);
 
     GUI_DispStringHCenterAt("Tap to Restart", screen_w / 2, box_y + 65);
-}
\ No newline at end of file
+}
+#endif
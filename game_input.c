@@ -0,0 +1,150 @@
+#include "game_input.h"
+#include "input.h"
+#include "cmsis_os2.h"
+#include <stddef.h>
+
+/* =========================================================================
+   CONFIGURATION
+   ========================================================================= */
+#define INPUT_FIFO_SIZE      8      // Queued actions (power of two)
+
+/* Keypad press/release events and touch gestures are turned into logical
+   actions here and queued, so a press that lands between two game ticks
+   is still there on the next one. Everything runs on the game thread
+   inside Input_Poll: no locking. */
+static const Input_Map_t *input_map;
+static uint8_t  use_gestures;           // Map has gesture actions: feed the recognizer
+
+static uint16_t repeat_delay;
+static uint16_t repeat_rate;
+static uint16_t held;                   // Bindings held, bit = index in input_map->keys
+static int8_t   repeat_idx = -1;        // Binding that is auto-repeating, -1 = none
+static uint32_t repeat_due;
+
+static uint8_t  fifo[INPUT_FIFO_SIZE];
+static uint32_t fifo_head, fifo_tail;
+
+static void Input_Push(uint8_t act) {
+    if (act == INPUT_NONE) return;
+    if ((fifo_head - fifo_tail) >= INPUT_FIFO_SIZE) return;    // Full: drop the newest
+    fifo[fifo_head & (INPUT_FIFO_SIZE - 1)] = act;
+    fifo_head++;
+}
+
+static int Input_FindKey(char key) {
+    for (int i = 0; i < input_map->num_keys; i++) {
+        if (input_map->keys[i].key == key) return i;
+    }
+    return -1;
+}
+
+// Another repeating binding still held takes over when the repeating one goes up
+static int8_t Input_NextRepeat(void) {
+    for (int i = 0; i < input_map->num_keys; i++) {
+        if ((held & (1U << i)) && input_map->keys[i].repeat) return (int8_t)i;
+    }
+    return -1;
+}
+
+/* Switch to a game's mapping and start from a clean slate */
+void Input_Begin(const Input_Map_t *map) {
+    input_map    = map;
+    use_gestures = 0;
+    for (int g = 0; g <= SWIPE_DRAG; g++) {
+        if (map->gesture[g] != INPUT_NONE) use_gestures = 1;
+    }
+    Input_SetRepeat(map->repeat_delay_ms, map->repeat_rate_ms);
+    Input_Flush();
+}
+
+/* rate_ms 0 turns auto-repeat off */
+void Input_SetRepeat(uint16_t delay_ms, uint16_t rate_ms) {
+    repeat_delay = delay_ms;
+    repeat_rate  = rate_ms;
+}
+
+/* Drop queued actions, pending keypad/touch events and held keys */
+void Input_Flush(void) {
+    Keypad_FlushEvents();
+    Touch_Reset_Swipe();        // Also flushes the touch event ring
+    held       = 0;
+    repeat_idx = -1;
+    fifo_tail  = fifo_head;
+}
+
+/*
+ * Non-blocking: drains the keypad and touch events that arrived since the
+ * last call, adds due auto-repeats and queues the resulting actions.
+ * Call it once per game tick, then pop with Input_Get.
+ */
+void Input_Poll(void) {
+    Keypad_Event_t kev;
+    uint32_t now = osKernelGetTickCount();
+
+    if (input_map == NULL) return;
+
+    /* --- Keypad --- */
+    while (Keypad_GetEvent(&kev, 0)) {
+        int idx = Input_FindKey(kev.key);
+
+        if (idx < 0) continue;
+        const Input_KeyBind_t *b = &input_map->keys[idx];
+
+        if (kev.type == KEY_EVT_PRESS) {
+            held |= (uint16_t)(1U << idx);
+            Input_Push(b->action);
+            if (b->repeat) {
+                repeat_idx = (int8_t)idx;       // Newest press repeats
+                repeat_due = now + repeat_delay;
+            }
+        } else {
+            held &= (uint16_t)~(1U << idx);
+            if (idx == repeat_idx) {
+                repeat_idx = Input_NextRepeat();
+                repeat_due = now + repeat_delay;
+            }
+        }
+    }
+
+    // At most one repeat per call: a stalled loop must not get a burst
+    if ((repeat_idx >= 0) && (repeat_rate > 0U) && ((int32_t)(now - repeat_due) >= 0)) {
+        Input_Push(input_map->keys[repeat_idx].action);
+        repeat_due += repeat_rate;
+        if ((int32_t)(now - repeat_due) >= 0) repeat_due = now + repeat_rate;
+    }
+
+    /* --- Touch --- */
+    if (use_gestures) {
+        Swipe_Dir_t g;
+
+        while ((g = Touch_Update_Swipe()) != SWIPE_NONE) Input_Push(input_map->gesture[g]);
+    } else if (input_map->touch_down != INPUT_NONE) {
+        Touch_Event_t ev[8];
+        int n;
+
+        while ((n = Touch_PollEvents(ev, 8)) > 0) {
+            for (int i = 0; i < n; i++) {
+                if (ev[i].type == TOUCH_EVT_DOWN) Input_Push(input_map->touch_down);
+            }
+        }
+    } else {
+        Touch_FlushEvents();    // Touch unused: don't let stale events pile up
+    }
+}
+
+/* Pop the oldest queued action, 0 when there is none */
+int Input_Get(Input_Action_t *act) {
+    if (fifo_tail == fifo_head) return 0;
+    *act = (Input_Action_t)fifo[fifo_tail & (INPUT_FIFO_SIZE - 1)];
+    fifo_tail++;
+    return 1;
+}
+
+/* A key bound to this action is down (as of the last Input_Poll) */
+int Input_Held(Input_Action_t act) {
+    if (input_map == NULL) return 0;
+    for (int i = 0; i < input_map->num_keys; i++) {
+        if ((held & (1U << i)) && (input_map->keys[i].action == act)) return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,46 @@
+#ifndef GAME_INPUT_H
+#define GAME_INPUT_H
+
+#include <stdint.h>
+#include "Swipe_check.h"
+
+/* Logical actions shared by every game; keypad and touch are mapped onto
+   these through a per-game Input_Map_t. */
+typedef enum {
+    INPUT_NONE = 0,
+    INPUT_UP,
+    INPUT_DOWN,
+    INPUT_LEFT,
+    INPUT_RIGHT,
+    INPUT_ACTION,
+    INPUT_RESTART,
+    INPUT_EXIT,
+    INPUT_ACTION_COUNT
+} Input_Action_t;
+
+// Most key bindings in one map (held keys are tracked in a 16-bit mask)
+#define INPUT_KEYS_MAX      16
+
+typedef struct {
+    char    key;                // keyMap character
+    uint8_t action;             // Input_Action_t
+    uint8_t repeat;             // Auto-repeat while held
+} Input_KeyBind_t;
+
+typedef struct {
+    const Input_KeyBind_t *keys;
+    uint8_t  num_keys;
+    uint8_t  gesture[SWIPE_DRAG + 1];   // Swipe_Dir_t -> action, INPUT_NONE = ignored
+    uint8_t  touch_down;                // Action on a raw DOWN edge (used when no gesture is mapped)
+    uint16_t repeat_delay_ms;           // Press to first repeat
+    uint16_t repeat_rate_ms;            // Between repeats
+} Input_Map_t;
+
+void Input_Begin(const Input_Map_t *map);
+void Input_SetRepeat(uint16_t delay_ms, uint16_t rate_ms);
+void Input_Poll(void);
+int  Input_Get(Input_Action_t *act);
+int  Input_Held(Input_Action_t act);
+void Input_Flush(void);
+
+#endif
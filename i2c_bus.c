@@ -0,0 +1,221 @@
+#include "i2c_bus.h"
+#include "Driver_I2C.h"
+#include <string.h>
+
+/* =========================================================================
+   CONFIGURATION
+   ========================================================================= */
+#define I2C_BUS_QUEUE_LEN    8U
+#define I2C_BUS_TIMEOUT_MS   10U     // Per bus transaction
+#define I2C_BUS_MERGE_MAX    16U     // Largest merged write (register + data)
+#define I2C_BUS_MERGE_WAIT   1U      // Ticks to wait for the next mergeable write
+#define I2C_BUS_STK_SZ       (512U)
+
+// Thread flag used by the driver callback to wake the bus thread
+#define I2C_BUS_EVT_DONE     0x01U
+
+extern ARM_DRIVER_I2C Driver_I2C1;
+
+static osMessageQueueId_t bus_queue;
+static osThreadId_t       bus_tid;
+static volatile uint32_t  bus_event;
+
+static uint64_t i2c_bus_stk[I2C_BUS_STK_SZ / 8];
+static const osThreadAttr_t i2c_bus_attr = {
+    .name       = "i2c_bus",
+    .stack_mem  = &i2c_bus_stk[0],
+    .stack_size = sizeof(i2c_bus_stk),
+    .priority   = osPriorityAboveNormal
+};
+
+/* =========================================================================
+   DRIVER ACCESS (bus thread only)
+   ========================================================================= */
+static void I2C_Bus_DriverEvent(uint32_t event) {
+    bus_event = event;
+    osThreadFlagsSet(bus_tid, I2C_BUS_EVT_DONE);
+}
+
+static int32_t I2C_Bus_Wait(int32_t start_status) {
+    if (start_status != ARM_DRIVER_OK) return start_status;
+
+    if (osThreadFlagsWait(I2C_BUS_EVT_DONE, osFlagsWaitAny, I2C_BUS_TIMEOUT_MS) & osFlagsError) {
+        Driver_I2C1.Control(ARM_I2C_ABORT_TRANSFER, 0);
+        return ARM_DRIVER_ERROR_TIMEOUT;
+    }
+    if (bus_event & (ARM_I2C_EVENT_TRANSFER_INCOMPLETE | ARM_I2C_EVENT_ADDRESS_NACK |
+                     ARM_I2C_EVENT_BUS_ERROR | ARM_I2C_EVENT_ARBITRATION_LOST)) {
+        return ARM_DRIVER_ERROR;
+    }
+    return ARM_DRIVER_OK;
+}
+
+static int32_t I2C_Bus_Execute(uint8_t addr, const uint8_t *wr, uint32_t wr_len,
+                               uint8_t *rd, uint32_t rd_len) {
+    int32_t status = ARM_DRIVER_OK;
+
+    if (wr_len > 0U) {
+        // Keep the bus (repeated START) when a read follows
+        status = I2C_Bus_Wait(Driver_I2C1.MasterTransmit(addr, wr, wr_len, rd_len > 0U));
+    }
+    if ((status == ARM_DRIVER_OK) && (rd_len > 0U)) {
+        status = I2C_Bus_Wait(Driver_I2C1.MasterReceive(addr, rd, rd_len, false));
+    }
+    return status;
+}
+
+static void I2C_Bus_Signal(const I2C_Bus_Xfer_t *x, int32_t status) {
+    if (x->result != NULL) *x->result = status;
+    if (x->owner  != NULL) osThreadFlagsSet(x->owner, x->done_flag);
+}
+
+static int I2C_Bus_CanMerge(const I2C_Bus_Xfer_t *x) {
+    return (x->flags & I2C_BUS_FLAG_MERGE) && (x->rd_len == 0U) && (x->wr_len >= 2U);
+}
+
+/* =========================================================================
+   BUS THREAD
+   ========================================================================= */
+static __NO_RETURN void I2C_Bus_Thread(void *argument) {
+    static I2C_Bus_Xfer_t merged[I2C_BUS_MERGE_MAX];
+    uint8_t        burst[I2C_BUS_MERGE_MAX];
+    I2C_Bus_Xfer_t next;
+    int            have_next = 0;
+
+    (void)argument;
+
+    while (1) {
+        uint32_t n = 1U;
+        uint32_t len;
+        int32_t  status;
+
+        if (have_next) {
+            merged[0] = next;
+            have_next = 0;
+        } else if (osMessageQueueGet(bus_queue, &merged[0], NULL, osWaitForever) != osOK) {
+            continue;
+        }
+
+        if (!I2C_Bus_CanMerge(&merged[0])) {
+            status = I2C_Bus_Execute(merged[0].addr, merged[0].wr, merged[0].wr_len,
+                                     merged[0].rd, merged[0].rd_len);
+            I2C_Bus_Signal(&merged[0], status);
+            continue;
+        }
+
+        // Collect back-to-back writes to consecutive registers of the same device.
+        // The bus thread outranks its clients, so give the writer one tick to
+        // queue the rest of its sequence; any other request ends the wait.
+        memcpy(burst, merged[0].wr, merged[0].wr_len);
+        len = merged[0].wr_len;
+
+        while ((n < I2C_BUS_MERGE_MAX) && (osMessageQueueGet(bus_queue, &next, NULL, I2C_BUS_MERGE_WAIT) == osOK)) {
+            uint8_t next_reg = (uint8_t)(merged[0].wr[0] + (len - 1U));
+
+            if (I2C_Bus_CanMerge(&next) && (next.addr == merged[0].addr) &&
+                (next.wr[0] == next_reg) && ((len + next.wr_len - 1U) <= sizeof(burst))) {
+                memcpy(&burst[len], &next.wr[1], next.wr_len - 1U);
+                len += next.wr_len - 1U;
+                merged[n++] = next;
+            } else {
+                have_next = 1;
+                break;
+            }
+        }
+        if (n > 1U) burst[0] |= merged[0].incr;
+
+        status = I2C_Bus_Execute(merged[0].addr, burst, len, NULL, 0U);
+        for (uint32_t i = 0U; i < n; i++) {
+            I2C_Bus_Signal(&merged[i], status);
+        }
+    }
+}
+
+/* =========================================================================
+   PUBLIC API
+   ========================================================================= */
+int32_t I2C_Bus_Init(void) {
+    if (bus_tid != NULL) return ARM_DRIVER_OK;
+
+    bus_queue = osMessageQueueNew(I2C_BUS_QUEUE_LEN, sizeof(I2C_Bus_Xfer_t), NULL);
+    bus_tid   = osThreadNew(I2C_Bus_Thread, NULL, &i2c_bus_attr);
+    if ((bus_queue == NULL) || (bus_tid == NULL)) return ARM_DRIVER_ERROR;
+
+    Driver_I2C1.Initialize(I2C_Bus_DriverEvent);
+    Driver_I2C1.PowerControl(ARM_POWER_FULL);
+    Driver_I2C1.Control(ARM_I2C_BUS_SPEED, ARM_I2C_BUS_SPEED_FAST); // 400 kHz, touch and codec max
+    return ARM_DRIVER_OK;
+}
+
+// Queue a descriptor; its priority orders it against other queued work
+int32_t I2C_Bus_Submit(const I2C_Bus_Xfer_t *xfer) {
+    if ((xfer == NULL) || (xfer->wr_len > I2C_BUS_INLINE_MAX)) return ARM_DRIVER_ERROR_PARAMETER;
+    if (bus_queue == NULL) return ARM_DRIVER_ERROR;
+
+    if (osMessageQueuePut(bus_queue, xfer, xfer->prio, osWaitForever) != osOK) return ARM_DRIVER_ERROR;
+    return ARM_DRIVER_OK;
+}
+
+// Queue a write/read and sleep until the bus thread has executed it
+int32_t I2C_Bus_Transfer(uint8_t addr, const uint8_t *wr, uint8_t wr_len,
+                         uint8_t *rd, uint16_t rd_len, uint8_t prio) {
+    I2C_Bus_Xfer_t   x;
+    volatile int32_t result = ARM_DRIVER_ERROR;
+
+    if (wr_len > I2C_BUS_INLINE_MAX) return ARM_DRIVER_ERROR_PARAMETER;
+
+    memset(&x, 0, sizeof(x));
+    x.addr      = addr;
+    x.prio      = prio;
+    x.wr_len    = wr_len;
+    if (wr_len > 0U) memcpy(x.wr, wr, wr_len);
+    x.rd        = rd;
+    x.rd_len    = rd_len;
+    x.owner     = osThreadGetId();
+    x.done_flag = I2C_BUS_DONE_FLAG;
+    x.result    = &result;
+
+    if (I2C_Bus_Submit(&x) != ARM_DRIVER_OK) return ARM_DRIVER_ERROR;
+    osThreadFlagsWait(I2C_BUS_DONE_FLAG, osFlagsWaitAny, osWaitForever);
+    return result;
+}
+
+// Fire-and-forget register write, mergeable with adjacent registers
+int32_t I2C_Bus_WriteReg(uint8_t addr, uint8_t reg, uint8_t val, uint8_t prio, uint8_t incr) {
+    I2C_Bus_Xfer_t x;
+
+    memset(&x, 0, sizeof(x));
+    x.addr   = addr;
+    x.prio   = prio;
+    x.flags  = I2C_BUS_FLAG_MERGE;
+    x.incr   = incr;
+    x.wr_len = 2U;
+    x.wr[0]  = reg;
+    x.wr[1]  = val;
+    return I2C_Bus_Submit(&x);
+}
+
+// Fire-and-forget write of n consecutive registers as auto-increment bursts,
+// split at the inline descriptor size
+int32_t I2C_Bus_WriteRegs(uint8_t addr, uint8_t reg, const uint8_t *vals, uint32_t n,
+                          uint8_t prio, uint8_t incr) {
+    I2C_Bus_Xfer_t x;
+    int32_t        status = ARM_DRIVER_OK;
+
+    while ((n > 0U) && (status == ARM_DRIVER_OK)) {
+        uint32_t chunk = (n < (I2C_BUS_INLINE_MAX - 1U)) ? n : (I2C_BUS_INLINE_MAX - 1U);
+
+        memset(&x, 0, sizeof(x));
+        x.addr   = addr;
+        x.prio   = prio;
+        x.wr_len = (uint8_t)(chunk + 1U);
+        x.wr[0]  = (chunk > 1U) ? (uint8_t)(reg | incr) : reg;
+        memcpy(&x.wr[1], vals, chunk);
+        status = I2C_Bus_Submit(&x);
+
+        reg  += (uint8_t)chunk;
+        vals += chunk;
+        n    -= chunk;
+    }
+    return status;
+}
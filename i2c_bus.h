@@ -0,0 +1,46 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <stdint.h>
+#include "cmsis_os2.h"
+
+/* One thread owns Driver_I2C1; everybody else queues transaction
+   descriptors. Higher priority descriptors are served first. */
+
+// Queue priorities (touch sampling ahead of codec configuration)
+#define I2C_BUS_PRIO_CODEC   1U
+#define I2C_BUS_PRIO_TOUCH   2U
+
+// Descriptor may be merged with a following write to the next register
+// of the same device into one auto-increment transfer
+#define I2C_BUS_FLAG_MERGE   0x01U
+
+// Thread flag set on the owner when its descriptor has been executed
+#define I2C_BUS_DONE_FLAG    0x00010000U
+
+// Bytes of write data carried inside the descriptor (register + payload)
+#define I2C_BUS_INLINE_MAX   8U
+
+typedef struct {
+    uint8_t           addr;                      // 7-bit device address
+    uint8_t           prio;                      // I2C_BUS_PRIO_*
+    uint8_t           flags;                     // I2C_BUS_FLAG_*
+    uint8_t           incr;                      // OR-ed into the register byte of a merged burst
+    uint8_t           wr_len;                    // Bytes in wr[] (0 = read only)
+    uint8_t           wr[I2C_BUS_INLINE_MAX];    // Register + data, copied into the queue
+    uint8_t          *rd;                        // Read buffer, kept alive by the owner
+    uint16_t          rd_len;                    // Bytes to read after a repeated START
+    osThreadId_t      owner;                     // Signalled with done_flag, NULL = fire and forget
+    uint32_t          done_flag;
+    volatile int32_t *result;                    // ARM_DRIVER_OK or error, may be NULL
+} I2C_Bus_Xfer_t;
+
+int32_t I2C_Bus_Init(void);
+int32_t I2C_Bus_Submit(const I2C_Bus_Xfer_t *xfer);
+int32_t I2C_Bus_Transfer(uint8_t addr, const uint8_t *wr, uint8_t wr_len,
+                         uint8_t *rd, uint16_t rd_len, uint8_t prio);
+int32_t I2C_Bus_WriteReg(uint8_t addr, uint8_t reg, uint8_t val, uint8_t prio, uint8_t incr);
+int32_t I2C_Bus_WriteRegs(uint8_t addr, uint8_t reg, const uint8_t *vals, uint32_t n,
+                          uint8_t prio, uint8_t incr);
+
+#endif
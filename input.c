@@ -1,6 +1,10 @@
 #include "stm32f4xx.h"
+#include "stm32f4xx_hal.h"
 #include "input.h"
-#include "Driver_I2C.h"
+#include "i2c_bus.h"
+#include "cmsis_os2.h"
+#include <stddef.h>
+#include <string.h>
 
 
 
@@ -17,6 +21,8 @@ static const char keyMap[4][4] = {
     {'*','0','#','D'}  // Row 4 (PH7)
 };
 
+static void Keypad_ScanInit(void);
+
 void Keypad_Init(void)
 {
     /* 1. ENABLE CLOCKS: GPIOB, GPIOC, GPIOD, GPIOH */
@@ -53,6 +59,9 @@ void Keypad_Init(void)
     GPIOB->MODER &= ~(3 << (15*2)); // Input Mode
     GPIOB->PUPDR &= ~(3 << (15*2)); // Clear
     GPIOB->PUPDR |=  (1 << (15*2)); // Set Pull-Up (01)
+
+    /* 4. START THE BACKGROUND SCAN */
+    Keypad_ScanInit();
 }
 
 static inline void delay_small(void)
@@ -60,46 +69,172 @@ static inline void delay_small(void)
     for (volatile int i=0; i<3000; i++);
 }
 
-char Keypad_Get_Key(void)
+/* --- Background scan: TIM7 at 1 kHz, one row per tick ---
+   Each tick reads the columns of the row driven on the previous tick
+   (1 ms of settling) and then drives the next row, so every key is
+   sampled every 4 ms. A per-key integrator debounces the samples. */
+#define KEYPAD_SCAN_HZ          1000U
+#define KEYPAD_INTEGRATOR_MAX   5U      // Samples (x4 ms) to accept a change
+#define KEYPAD_QUEUE_LEN        16U
+#define KEYPAD_IRQ_PRIO         7U
+
+static osMessageQueueId_t keypad_queue;
+static volatile uint16_t  keypad_state;              // Debounced, bit = row*4 + col
+static volatile uint16_t  keypad_pressed;            // Edges latched until Keypad_GetState
+static volatile uint16_t  keypad_released;
+static volatile uint8_t   keypad_ghost;              // A press was held back on the last scan
+static uint8_t            keypad_ghost_scan;
+static uint8_t            keypad_integ[16];
+static uint8_t            keypad_row;
+
+static void Keypad_DriveRow(int row)
+{
+    // 1. SET ALL ROWS HIGH (Inactive)
+    GPIOC->BSRR = (1 << 12);
+    GPIOD->BSRR = (1 << 2);
+    GPIOH->BSRR = (1 << 6) | (1 << 7);
+
+    // 2. DRIVE CURRENT ROW LOW (Active)
+    if      (row == 0) GPIOC->BSRR = (1 << (12 + 16)); // PC12 Low
+    else if (row == 1) GPIOD->BSRR = (1 << (2 + 16));  // PD2 Low
+    else if (row == 2) GPIOH->BSRR = (1 << (6 + 16));  // PH6 Low
+    else if (row == 3) GPIOH->BSRR = (1 << (7 + 16));  // PH7 Low
+}
+
+/*
+ * No diodes in the matrix: with three corners of a row/column rectangle
+ * closed, the fourth reads closed too. Any two rows sharing two or more
+ * columns make the state ambiguous.
+ */
+static int Keypad_IsGhost(uint16_t state)
 {
-    for (int row = 0; row < 4; row++)
-    {
-        // 1. SET ALL ROWS HIGH (Inactive)
-        GPIOC->BSRR = (1 << 12);
-        GPIOD->BSRR = (1 << 2);
-        GPIOH->BSRR = (1 << 6) | (1 << 7);
-
-        // 2. DRIVE CURRENT ROW LOW (Active)
-        if      (row == 0) GPIOC->BSRR = (1 << (12 + 16)); // PC12 Low
-        else if (row == 1) GPIOD->BSRR = (1 << (2 + 16));  // PD2 Low
-        else if (row == 2) GPIOH->BSRR = (1 << (6 + 16));  // PH6 Low
-        else if (row == 3) GPIOH->BSRR = (1 << (7 + 16));  // PH7 Low
-
-        delay_small();
-
-        // 3. READ COLS (PC8, PC9, PC10, PB15)
-        uint32_t idrC = GPIOC->IDR;
-        
-        // Active Low: Pressing key reads 0
-        int c0 = !(idrC & (1<<8));         // Col 1: PC8
-        int c1 = !(idrC & (1<<9));         // Col 2: PC9
-        int c2 = !(idrC & (1<<10));        // Col 3: PC10
-        int c3 = !(GPIOB->IDR & (1<<15));  // Col 4: PB15 (New)
-
-        if (c0) return keyMap[row][0];
-        if (c1) return keyMap[row][1];
-        if (c2) return keyMap[row][2];
-        if (c3) return keyMap[row][3];
+    for (int r1 = 0; r1 < 3; r1++) {
+        for (int r2 = r1 + 1; r2 < 4; r2++) {
+            uint8_t common = ((state >> (r1 * 4)) & (state >> (r2 * 4))) & 0xF;
+            if (common & (common - 1)) return 1;
+        }
     }
     return 0;
 }
 
+void TIM7_IRQHandler(void)
+{
+    TIM7->SR = 0;
+
+    // 3. READ COLS (PC8, PC9, PC10, PB15), active low
+    uint32_t idrC = GPIOC->IDR;
+    uint8_t  raw  = (!(idrC & (1<<8))       ? 0x1 : 0) |
+                    (!(idrC & (1<<9))       ? 0x2 : 0) |
+                    (!(idrC & (1<<10))      ? 0x4 : 0) |
+                    (!(GPIOB->IDR & (1<<15)) ? 0x8 : 0);
+
+    for (int col = 0; col < 4; col++) {
+        int      bit  = keypad_row * 4 + col;
+        uint8_t *acc  = &keypad_integ[bit];
+        uint16_t mask = (uint16_t)(1U << bit);
+
+        if (raw & (1U << col)) { if (*acc < KEYPAD_INTEGRATOR_MAX) (*acc)++; }
+        else                   { if (*acc > 0) (*acc)--; }
+
+        // Change state only at the ends of the integrator
+        if ((*acc == KEYPAD_INTEGRATOR_MAX) && !(keypad_state & mask)) {
+            // Hold back a press that may only be a ghost of the others
+            if (Keypad_IsGhost(keypad_state | mask)) {
+                keypad_ghost_scan = 1;
+                continue;
+            }
+            Keypad_Event_t ev = { keyMap[keypad_row][col], KEY_EVT_PRESS };
+            keypad_state   |= mask;
+            keypad_pressed |= mask;
+            osMessageQueuePut(keypad_queue, &ev, 0, 0);     // Full queue drops the event
+        } else if ((*acc == 0) && (keypad_state & mask)) {
+            Keypad_Event_t ev = { keyMap[keypad_row][col], KEY_EVT_RELEASE };
+            keypad_state    &= ~mask;
+            keypad_released |= mask;
+            osMessageQueuePut(keypad_queue, &ev, 0, 0);
+        }
+    }
+
+    // End of a full pass over the matrix
+    if (keypad_row == 3) {
+        keypad_ghost      = keypad_ghost_scan;
+        keypad_ghost_scan = 0;
+    }
+
+    keypad_row = (keypad_row + 1) & 3;
+    Keypad_DriveRow(keypad_row);
+}
+
+static void Keypad_ScanInit(void)
+{
+    if (keypad_queue == NULL) {
+        keypad_queue = osMessageQueueNew(KEYPAD_QUEUE_LEN, sizeof(Keypad_Event_t), NULL);
+    }
 
+    keypad_row = 0;
+    Keypad_DriveRow(keypad_row);
+
+    // TIM7 on APB1: timer clock is 2 x PCLK1 (prescaled APB1)
+    RCC->APB1ENR |= RCC_APB1ENR_TIM7EN;
+    (void)RCC->APB1ENR;
+    TIM7->CR1  = 0;
+    TIM7->PSC  = (2U * HAL_RCC_GetPCLK1Freq()) / 1000000U - 1U;  // 1 MHz
+    TIM7->ARR  = (1000000U / KEYPAD_SCAN_HZ) - 1U;
+    TIM7->EGR  = TIM_EGR_UG;
+    TIM7->SR   = 0;
+    TIM7->DIER = TIM_DIER_UIE;
+
+    NVIC_SetPriority(TIM7_IRQn, KEYPAD_IRQ_PRIO);
+    NVIC_EnableIRQ(TIM7_IRQn);
+    TIM7->CR1  = TIM_CR1_CEN;
+}
 
+/* Debounced key currently held (first in keymap order), no scanning */
+char Keypad_Get_Key(void)
+{
+    uint16_t state = keypad_state;
 
+    for (int bit = 0; bit < 16; bit++) {
+        if (state & (1U << bit)) return keyMap[bit >> 2][bit & 3];
+    }
+    return 0;
+}
 
+/* Whole-matrix snapshot; the edge masks are cleared by reading them */
+void Keypad_GetState(Keypad_State_t *st)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    st->held     = keypad_state;
+    st->pressed  = keypad_pressed;
+    st->released = keypad_released;
+    st->ghost    = keypad_ghost;
+    keypad_pressed  = 0;
+    keypad_released = 0;
+    __set_PRIMASK(primask);
+}
 
+/* Bit for one keyMap character, 0 if there is no such key */
+uint16_t Keypad_Mask(char key)
+{
+    for (int bit = 0; bit < 16; bit++) {
+        if (keyMap[bit >> 2][bit & 3] == key) return (uint16_t)(1U << bit);
+    }
+    return 0;
+}
 
+/* Pop one press/release event; timeout 0 polls, osWaitForever blocks */
+int Keypad_GetEvent(Keypad_Event_t *ev, uint32_t timeout)
+{
+    if (keypad_queue == NULL) return 0;
+    return osMessageQueueGet(keypad_queue, ev, NULL, timeout) == osOK;
+}
+
+void Keypad_FlushEvents(void)
+{
+    if (keypad_queue != NULL) osMessageQueueReset(keypad_queue);
+}
 
 /* =========================================================================
    TOUCHSCREEN SECTION (STMPE811 via I2C1)
@@ -108,33 +243,359 @@ char Keypad_Get_Key(void)
 #define STMPE811_ADDR           0x41 
 #define STMPE811_REG_SYS_CTRL1  0x03
 #define STMPE811_REG_SYS_CTRL2  0x04
+#define STMPE811_REG_INT_CTRL   0x09
+#define STMPE811_REG_INT_EN     0x0A
+#define STMPE811_REG_INT_STA    0x0B
 #define STMPE811_REG_TSC_CTRL   0x40
 #define STMPE811_REG_TSC_CFG    0x41
+#define STMPE811_REG_FIFO_TH    0x4A
 #define STMPE811_REG_FIFO_STA   0x4B
 #define STMPE811_REG_FIFO_SIZE  0x4C
 #define STMPE811_REG_TSC_DATA_X 0x4D 
-
-extern ARM_DRIVER_I2C Driver_I2C1; 
-
+#define STMPE811_REG_TSC_DATA   0xD7    // Non auto-increment FIFO port
+
+#define STMPE811_INT_TOUCH_DET  0x01
+#define STMPE811_INT_FIFO_TH    0x02
+#define STMPE811_INT_FIFO_OFLOW 0x04
+
+#define TOUCH_FIFO_TH           4       // Samples per FIFO_TH interrupt
+#define TOUCH_FIFO_RESET_LEVEL  (2 * TOUCH_BURST_MAX)
+
+// STMPE811 INT line (open drain, active low) -> EXTI, adjust to board wiring
+#define TOUCH_INT_GPIO          GPIOI
+#define TOUCH_INT_GPIO_EN       RCC_AHB1ENR_GPIOIEN
+#define TOUCH_INT_PIN           2U
+#define TOUCH_INT_EXTI_PORT     8U      // SYSCFG_EXTICR code for port I
+#define TOUCH_INT_IRQn          EXTI2_IRQn
+#define TOUCH_INT_IRQ_PRIO      6U
+
+// Safety net while a finger is down, in case an INT edge was missed
+#define TOUCH_HOLD_POLL_MS      50U
+// Slow poll with no finger down: touch keeps working if TOUCH_INT_PIN is wired elsewhere
+#define TOUCH_IDLE_POLL_MS      100U
+
+#define TOUCH_EVENT_RING_SIZE   32      // Power of two
+#define TOUCH_MOVE_MIN          1       // px before a MOVE is reported
+#define TOUCH_FLAG_IRQ          0x01U
+#define TOUCH_STK_SZ            (768U)
+
+/* All bus traffic goes through the I2C bus manager (i2c_bus.c), which
+   serves touch requests ahead of codec configuration. */
 static void STMPE811_Write(uint8_t reg, uint8_t val) {
     uint8_t data[2] = {reg, val};
-    Driver_I2C1.MasterTransmit(STMPE811_ADDR, data, 2, false);
-    // Note: If driver is non-blocking, you might need a check here to wait for completion
-    // e.g., while(Driver_I2C1.GetStatus().busy);
+    I2C_Bus_Transfer(STMPE811_ADDR, data, 2, NULL, 0, I2C_BUS_PRIO_TOUCH);
 }
 
-static uint8_t STMPE811_Read(uint8_t reg) {
-    uint8_t val = 0;
-    Driver_I2C1.MasterTransmit(STMPE811_ADDR, &reg, 1, true); // No Stop bit (Repeated Start)
-    Driver_I2C1.MasterReceive(STMPE811_ADDR, &val, 1, false);
-    // Note: Add busy wait here if using async driver
-    return val;
+static int STMPE811_ReadBuf(uint8_t reg, uint8_t *buf, uint32_t num) {
+    // Register write + repeated START read as one queued transaction
+    return (I2C_Bus_Transfer(STMPE811_ADDR, &reg, 1, buf, (uint16_t)num, I2C_BUS_PRIO_TOUCH) == 0) ? 0 : -1;
+}
+
+/* --- Event ring: DOWN/MOVE/UP edges detected once, on the touch thread. ---
+   Single producer / single consumer, so head and tail are each written by
+   one side only and no lock is needed. */
+static Touch_Event_t     touch_events[TOUCH_EVENT_RING_SIZE];
+static volatile uint32_t touch_ev_head;
+static volatile uint32_t touch_ev_tail;
+
+static volatile uint8_t  touch_down;     // Finger on the panel (TOUCH_DET)
+static volatile uint32_t touch_latest;   // Newest x | (y << 16), one atomic word
+static volatile uint32_t touch_raw;      // Newest raw x | (y << 16), for calibration
+
+static osThreadId_t touch_tid;
+
+static uint64_t touch_stk[TOUCH_STK_SZ / 8];
+static const osThreadAttr_t touch_attr = {
+    .name       = "touch",
+    .stack_mem  = &touch_stk[0],
+    .stack_size = sizeof(touch_stk),
+    .priority   = osPriorityAboveNormal
+};
+
+static void Touch_EventPut(uint8_t type, int16_t x, int16_t y, uint32_t tick) {
+    uint32_t head = touch_ev_head;
+    Touch_Event_t *ev;
+
+    if ((head - touch_ev_tail) >= TOUCH_EVENT_RING_SIZE) return;
+    ev = &touch_events[head & (TOUCH_EVENT_RING_SIZE - 1)];
+    ev->type = type;
+    ev->x    = x;
+    ev->y    = y;
+    ev->tick = tick;
+    __DMB();
+    touch_ev_head = head + 1;
+}
+
+/* =========================================================================
+   CALIBRATION (Q16.16 affine map, raw 12-bit -> 240x320 screen)
+   ========================================================================= */
+// Last flash sector (11, 128 KB) of the 1 MB STM32F407IG. The project limits IROM1 to
+// 0x08000000-0x080DFFFF (Debug and Release) so the linker never places the image here
+#define TOUCH_CAL_ADDR          0x080E0000U
+#define TOUCH_CAL_SECTOR        11U
+#define TOUCH_CAL_MAGIC         0x54434131U     // "TCA1"
+#define TOUCH_CAL_MIN_DET       10000           // Reject near-collinear reference taps
+
+typedef struct {
+    uint32_t    magic;
+    Touch_Cal_t cal;
+    uint32_t    check;                           // ~(sum of the words above)
+} Touch_CalRecord_t;
+
+// Same result as the old raw*240/4096 scale with Y flipped
+static const Touch_Cal_t touch_cal_default = {
+    3840, 0, 0,
+    0, -5120, 320 << 16
+};
+
+static Touch_Cal_t touch_cal;
+
+static uint32_t Touch_CalCheck(const Touch_CalRecord_t *rec) {
+    const uint32_t *w = (const uint32_t *)rec;
+    uint32_t sum = 0;
+
+    for (uint32_t i = 0; i < (offsetof(Touch_CalRecord_t, check) / 4U); i++) sum += w[i];
+    return ~sum;
+}
+
+/* Map one raw sample: four multiplies, no divides */
+static void Touch_Map(uint16_t rawX, uint16_t rawY, int16_t *x, int16_t *y) {
+    int32_t calX = (touch_cal.a * rawX + touch_cal.b * rawY + touch_cal.c) >> 16;
+    int32_t calY = (touch_cal.d * rawX + touch_cal.e * rawY + touch_cal.f) >> 16;
+
+    // Boundary Checks
+    if (calX < 0) calX = 0;
+    if (calX > 240) calX = 240;
+    if (calY < 0) calY = 0;
+    if (calY > 320) calY = 320;
+
+    *x = (int16_t)calX;
+    *y = (int16_t)calY;
+}
+
+void Touch_GetCalibration(Touch_Cal_t *cal) {
+    osKernelLock();
+    *cal = touch_cal;
+    osKernelUnlock();
+}
+
+void Touch_SetCalibration(const Touch_Cal_t *cal) {
+    // The touch thread maps samples with this matrix; keep it from seeing half an update
+    osKernelLock();
+    touch_cal = *cal;
+    osKernelUnlock();
+}
+
+void Touch_ResetCalibration(void) {
+    Touch_SetCalibration(&touch_cal_default);
+}
+
+/*
+ * Solve screen = M * raw for three reference points (Cramer's rule).
+ * The divides happen once here, never per sample. The rounding offset
+ * is folded into C and F so Touch_Map only has to shift.
+ */
+int Touch_SolveCalibration(const int16_t scr[3][2], uint16_t raw[3][2], Touch_Cal_t *cal) {
+    int64_t x0 = raw[0][0] - raw[2][0], y0 = raw[0][1] - raw[2][1];
+    int64_t x1 = raw[1][0] - raw[2][0], y1 = raw[1][1] - raw[2][1];
+    int64_t det = x0 * y1 - x1 * y0;
+
+    if ((det < TOUCH_CAL_MIN_DET) && (det > -TOUCH_CAL_MIN_DET)) return -1;
+
+    for (int axis = 0; axis < 2; axis++) {
+        int64_t s0 = scr[0][axis] - scr[2][axis];
+        int64_t s1 = scr[1][axis] - scr[2][axis];
+        int64_t m  = ((s0 * y1 - s1 * y0) * 65536) / det;
+        int64_t n  = ((x0 * s1 - x1 * s0) * 65536) / det;
+        int64_t o  = ((int64_t)scr[2][axis] * 65536) - m * raw[2][0] - n * raw[2][1] + 0x8000;
+
+        if (axis == 0) { cal->a = (int32_t)m; cal->b = (int32_t)n; cal->c = (int32_t)o; }
+        else           { cal->d = (int32_t)m; cal->e = (int32_t)n; cal->f = (int32_t)o; }
+    }
+    return 0;
+}
+
+static int Touch_FlashWait(void) {
+    while (FLASH->SR & FLASH_SR_BSY);
+    return (FLASH->SR & (FLASH_SR_WRPERR | FLASH_SR_PGAERR | FLASH_SR_PGPERR |
+                         FLASH_SR_PGSERR | FLASH_SR_SOP)) ? -1 : 0;
+}
+
+/*
+ * Erase sector 11 and program the active matrix into it.
+ * Code fetches stall for the whole erase (~1 s), so call it from a
+ * calibration screen, never from a game loop.
+ */
+int Touch_SaveCalibration(void) {
+    Touch_CalRecord_t rec;
+    const uint32_t *src = (const uint32_t *)&rec;
+    volatile uint32_t *dst = (volatile uint32_t *)TOUCH_CAL_ADDR;
+    int err;
+
+    rec.magic = TOUCH_CAL_MAGIC;
+    Touch_GetCalibration(&rec.cal);
+    rec.check = Touch_CalCheck(&rec);
+
+    if (FLASH->CR & FLASH_CR_LOCK) {
+        FLASH->KEYR = 0x45670123U;
+        FLASH->KEYR = 0xCDEF89ABU;
+    }
+    while (FLASH->SR & FLASH_SR_BSY);
+    FLASH->SR = FLASH_SR_EOP | FLASH_SR_WRPERR | FLASH_SR_PGAERR | FLASH_SR_PGPERR |
+                FLASH_SR_PGSERR | FLASH_SR_SOP;
+
+    // 32-bit parallelism (2.7-3.6 V), sector erase
+    FLASH->CR = FLASH_CR_PSIZE_1 | FLASH_CR_SER | (TOUCH_CAL_SECTOR << FLASH_CR_SNB_Pos);
+    FLASH->CR |= FLASH_CR_STRT;
+    err = Touch_FlashWait();
+
+    if (!err) {
+        FLASH->CR = FLASH_CR_PSIZE_1 | FLASH_CR_PG;
+        for (uint32_t i = 0; (i < sizeof(rec) / 4U) && !err; i++) {
+            dst[i] = src[i];
+            err = Touch_FlashWait();
+        }
+    }
+    FLASH->CR = FLASH_CR_LOCK;
+
+    // The data cache may still hold the erased words
+    FLASH->ACR &= ~FLASH_ACR_DCEN;
+    FLASH->ACR |=  FLASH_ACR_DCRST;
+    FLASH->ACR &= ~FLASH_ACR_DCRST;
+    FLASH->ACR |=  FLASH_ACR_DCEN;
+
+    if (!err && (memcmp((const void *)TOUCH_CAL_ADDR, &rec, sizeof(rec)) != 0)) err = -1;
+    return err;
+}
+
+/* Use the stored matrix when the record checks out, else the default */
+static void Touch_LoadCalibration(void) {
+    const Touch_CalRecord_t *rec = (const Touch_CalRecord_t *)TOUCH_CAL_ADDR;
+
+    if ((rec->magic == TOUCH_CAL_MAGIC) && (rec->check == Touch_CalCheck(rec))) {
+        Touch_SetCalibration(&rec->cal);
+    } else {
+        Touch_ResetCalibration();
+    }
+}
+
+/*
+ * Burst sampling: one auto-increment read of TSC_CTRL..FIFO_SIZE, then one
+ * read of the non-incrementing TSC_DATA port that drains every queued
+ * packed XYZ sample. The FIFO is only reset when the backlog crosses
+ * TOUCH_FIFO_RESET_LEVEL. Runs on the touch thread only.
+ */
+static void Touch_Acquire(void) {
+    uint8_t status[STMPE811_REG_FIFO_SIZE - STMPE811_REG_TSC_CTRL + 1];
+    uint8_t data[TOUCH_BURST_MAX * 4];
+
+    if (STMPE811_ReadBuf(STMPE811_REG_TSC_CTRL, status, sizeof(status)) != 0) return;
+
+    uint8_t  ctrl = status[0];
+    uint8_t  size = status[STMPE811_REG_FIFO_SIZE - STMPE811_REG_TSC_CTRL];
+    uint32_t now  = osKernelGetTickCount();
+
+    // Check Touch Det (Bit 7) & Data Available
+    if (!(ctrl & 0x80)) {
+        if (touch_down) {
+            uint32_t latest = touch_latest;
+            Touch_EventPut(TOUCH_EVT_UP, (int16_t)(latest & 0xFFFF), (int16_t)(latest >> 16), now);
+        }
+        touch_down = 0;
+        return;
+    }
+    if (size == 0) return;
+
+    int n = (size < TOUCH_BURST_MAX) ? size : TOUCH_BURST_MAX;
+
+    if (STMPE811_ReadBuf(STMPE811_REG_TSC_DATA, data, n * 4) != 0) return;
+
+    if (size >= TOUCH_FIFO_RESET_LEVEL) {
+        // Stale backlog: drop it so the next burst starts with fresh data
+        STMPE811_Write(STMPE811_REG_FIFO_STA, 0x01);
+        STMPE811_Write(STMPE811_REG_FIFO_STA, 0x00);
+    }
+
+    for (int i = 0; i < n; i++) {
+        // Packed XYZ: X[11:4] | X[3:0] Y[11:8] | Y[7:0] | Z[7:0]
+        const uint8_t *d = &data[i * 4];
+        uint16_t rawX = ((uint16_t)d[0] << 4) | (d[1] >> 4);
+        uint16_t rawY = ((uint16_t)(d[1] & 0x0F) << 8) | d[2];
+        Touch_Sample_t smp;
+
+        touch_raw = rawX | ((uint32_t)rawY << 16);
+        Touch_Map(rawX, rawY, &smp.x, &smp.y);
+        smp.z = d[3];
+
+        if (!touch_down) {
+            Touch_EventPut(TOUCH_EVT_DOWN, smp.x, smp.y, now);
+            touch_down = 1;
+        } else {
+            uint32_t latest = touch_latest;
+            int16_t  dx = smp.x - (int16_t)(latest & 0xFFFF);
+            int16_t  dy = smp.y - (int16_t)(latest >> 16);
+
+            if ((dx >= TOUCH_MOVE_MIN) || (dx <= -TOUCH_MOVE_MIN) ||
+                (dy >= TOUCH_MOVE_MIN) || (dy <= -TOUCH_MOVE_MIN)) {
+                Touch_EventPut(TOUCH_EVT_MOVE, smp.x, smp.y, now);
+            } else {
+                continue;                        // Unchanged: keep the old anchor
+            }
+        }
+        touch_latest = (uint16_t)smp.x | ((uint32_t)(uint16_t)smp.y << 16);
+    }
+}
+
+/* Woken by the STMPE811 INT line; without a finger only a slow fallback poll */
+static __NO_RETURN void Touch_Thread(void *argument) {
+    (void)argument;
+
+    while (1) {
+        osThreadFlagsWait(TOUCH_FLAG_IRQ, osFlagsWaitAny,
+                          touch_down ? TOUCH_HOLD_POLL_MS : TOUCH_IDLE_POLL_MS);
+        int rounds = 0;
+
+        do {
+            uint8_t sta = 0;
+
+            STMPE811_ReadBuf(STMPE811_REG_INT_STA, &sta, 1);
+            Touch_Acquire();
+            if (sta) STMPE811_Write(STMPE811_REG_INT_STA, sta); // Write 1 to clear
+            // INT is level: still low means another source fired meanwhile
+        } while (!(TOUCH_INT_GPIO->IDR & (1U << TOUCH_INT_PIN)) && (++rounds < 4));
+    }
+}
+
+void EXTI2_IRQHandler(void) {
+    EXTI->PR = (1U << TOUCH_INT_PIN);
+    osThreadFlagsSet(touch_tid, TOUCH_FLAG_IRQ);
+}
+
+static void Touch_IntInit(void) {
+    // INT pin: input with pull-up, falling edge on EXTI
+    RCC->AHB1ENR |= TOUCH_INT_GPIO_EN;
+    RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;
+    (void)RCC->APB2ENR;
+
+    TOUCH_INT_GPIO->MODER &= ~(3U << (TOUCH_INT_PIN * 2U));
+    TOUCH_INT_GPIO->PUPDR &= ~(3U << (TOUCH_INT_PIN * 2U));
+    TOUCH_INT_GPIO->PUPDR |=  (1U << (TOUCH_INT_PIN * 2U));
+
+    SYSCFG->EXTICR[TOUCH_INT_PIN / 4U] &= ~(0xFU << ((TOUCH_INT_PIN % 4U) * 4U));
+    SYSCFG->EXTICR[TOUCH_INT_PIN / 4U] |=  (TOUCH_INT_EXTI_PORT << ((TOUCH_INT_PIN % 4U) * 4U));
+
+    EXTI->RTSR &= ~(1U << TOUCH_INT_PIN);
+    EXTI->FTSR |=  (1U << TOUCH_INT_PIN);
+    EXTI->PR    =  (1U << TOUCH_INT_PIN);
+    EXTI->IMR  |=  (1U << TOUCH_INT_PIN);
+
+    NVIC_SetPriority(TOUCH_INT_IRQn, TOUCH_INT_IRQ_PRIO);
+    NVIC_EnableIRQ(TOUCH_INT_IRQn);
 }
 
 void Touch_Init(void) {
-    Driver_I2C1.Initialize(NULL);
-    Driver_I2C1.PowerControl(ARM_POWER_FULL);
-    Driver_I2C1.Control(ARM_I2C_BUS_SPEED, ARM_I2C_BUS_SPEED_STANDARD); // Ensure speed is set
+    Touch_LoadCalibration();
+    I2C_Bus_Init();             // Owns Driver_I2C1, runs it at 400 kHz
 
     STMPE811_Write(STMPE811_REG_SYS_CTRL1, 0x02); // Soft Reset
     delay_small(); 
@@ -142,44 +603,55 @@ void Touch_Init(void) {
     
     STMPE811_Write(STMPE811_REG_SYS_CTRL2, 0x0C); // Enable TSC/ADC Clock
     STMPE811_Write(STMPE811_REG_TSC_CFG, 0xC4);   // Average 8 samples
+    STMPE811_Write(STMPE811_REG_FIFO_TH, TOUCH_FIFO_TH);
     STMPE811_Write(STMPE811_REG_TSC_CTRL, 0x01);  // XYZ Mode enable
     STMPE811_Write(STMPE811_REG_FIFO_STA, 0x01);  // Reset FIFO
     STMPE811_Write(STMPE811_REG_FIFO_STA, 0x00);
+
+    if (touch_tid == NULL) touch_tid = osThreadNew(Touch_Thread, NULL, &touch_attr);
+    Touch_IntInit();
+
+    // Interrupt on touch down/up and FIFO threshold; level, active low
+    STMPE811_Write(STMPE811_REG_INT_STA, 0xFF);
+    STMPE811_Write(STMPE811_REG_INT_EN, STMPE811_INT_TOUCH_DET | STMPE811_INT_FIFO_TH | STMPE811_INT_FIFO_OFLOW);
+    STMPE811_Write(STMPE811_REG_INT_CTRL, 0x01);  // GLOBAL_INT
 }
 
-int Touch_GetCoord(int16_t *x, int16_t *y) {
-    uint8_t ctrl = STMPE811_Read(STMPE811_REG_TSC_CTRL);
-    
-    // Check Touch Det (Bit 7) & Data Available
-    if ((ctrl & 0x80) && (STMPE811_Read(STMPE811_REG_FIFO_SIZE) > 0)) {
-        uint8_t data[4];
-        uint8_t reg = STMPE811_REG_TSC_DATA_X;
-        
-        Driver_I2C1.MasterTransmit(STMPE811_ADDR, &reg, 1, true);
-        Driver_I2C1.MasterReceive(STMPE811_ADDR, data, 4, false);
-
-        // Clear FIFO to prevent old data buildup
-        STMPE811_Write(STMPE811_REG_FIFO_STA, 0x01);
-        STMPE811_Write(STMPE811_REG_FIFO_STA, 0x00);
+/* Pop DOWN/MOVE/UP events (oldest first), no bus access */
+int Touch_PollEvents(Touch_Event_t *buf, int max) {
+    int n = 0;
+    uint32_t tail = touch_ev_tail;
+
+    while ((n < max) && (tail != touch_ev_head)) {
+        __DMB();
+        buf[n++] = touch_events[tail & (TOUCH_EVENT_RING_SIZE - 1)];
+        tail++;
+    }
+    __DMB();
+    touch_ev_tail = tail;
+    return n;
+}
 
-        uint16_t rawX = (data[0] << 8) | data[1];
-        uint16_t rawY = (data[2] << 8) | data[3];
+void Touch_FlushEvents(void) {
+    touch_ev_tail = touch_ev_head;
+}
 
-        /* CALIBRATION (240x320) */
-        // Note: Using 32-bit cast to prevent overflow during multiplication
-        uint32_t calX = ((uint32_t)rawX * 240) / 4096;
-        uint32_t calY = ((uint32_t)rawY * 320) / 4096;
+int Touch_GetCoord(int16_t *x, int16_t *y) {
+    if (!touch_down) return 0;
 
-        *y = 320 - calY; 
-        *x = calX;
+    // Newest sample wins
+    uint32_t latest = touch_latest;
+    *x = (int16_t)(latest & 0xFFFF);
+    *y = (int16_t)(latest >> 16);
+    return 1;
+}
 
-        // Boundary Checks
-        if (*y < 0) *y = 0;
-        if (*y > 320) *y = 320;
-        if (*x < 0) *x = 0;
-        if (*x > 240) *x = 240;
-        
-        return 1; 
-    }
-    return 0; 
-}
\ No newline at end of file
+/* Unmapped 12-bit reading of the newest sample, for the calibration screen */
+int Touch_GetRaw(uint16_t *x, uint16_t *y) {
+    if (!touch_down) return 0;
+
+    uint32_t raw = touch_raw;
+    *x = (uint16_t)(raw & 0xFFFF);
+    *y = (uint16_t)(raw >> 16);
+    return 1;
+}
@@ -4,11 +4,87 @@
 #include <stdint.h>
 
 // --- Keypad Definitions ---
+typedef enum {
+    KEY_EVT_PRESS = 1,
+    KEY_EVT_RELEASE
+} Keypad_EventType_t;
+
+typedef struct {
+    char    key;        // keyMap character
+    uint8_t type;       // Keypad_EventType_t
+} Keypad_Event_t;
+
+// Matrix state, one bit per key: bit = row*4 + col
+typedef struct {
+    uint16_t held;          // Debounced, every closed key
+    uint16_t pressed;       // Went down since the last Keypad_GetState
+    uint16_t released;      // Went up since the last Keypad_GetState
+    uint8_t  ghost;         // Last scan held back an ambiguous (ghost) press
+} Keypad_State_t;
+
+#define KEYPAD_MASK(row, col)   ((uint16_t)(1U << ((row) * 4 + (col))))
+#define KEYPAD_1    KEYPAD_MASK(0, 0)
+#define KEYPAD_2    KEYPAD_MASK(0, 1)
+#define KEYPAD_3    KEYPAD_MASK(0, 2)
+#define KEYPAD_A    KEYPAD_MASK(0, 3)
+#define KEYPAD_4    KEYPAD_MASK(1, 0)
+#define KEYPAD_5    KEYPAD_MASK(1, 1)
+#define KEYPAD_6    KEYPAD_MASK(1, 2)
+#define KEYPAD_B    KEYPAD_MASK(1, 3)
+#define KEYPAD_7    KEYPAD_MASK(2, 0)
+#define KEYPAD_8    KEYPAD_MASK(2, 1)
+#define KEYPAD_9    KEYPAD_MASK(2, 2)
+#define KEYPAD_C    KEYPAD_MASK(2, 3)
+#define KEYPAD_STAR KEYPAD_MASK(3, 0)
+#define KEYPAD_0    KEYPAD_MASK(3, 1)
+#define KEYPAD_HASH KEYPAD_MASK(3, 2)
+#define KEYPAD_D    KEYPAD_MASK(3, 3)
+
 void Keypad_Init(void);
 char Keypad_Get_Key(void);
+void Keypad_GetState(Keypad_State_t *st);
+uint16_t Keypad_Mask(char key);
+int  Keypad_GetEvent(Keypad_Event_t *ev, uint32_t timeout);
+void Keypad_FlushEvents(void);
 
 // --- Touch & Swipe Definitions ---
 
+// Most samples pulled from the STMPE811 FIFO by one burst read
+#define TOUCH_BURST_MAX 8
+
+typedef struct {
+    int16_t x, y;   // Screen coordinates
+    uint8_t z;      // Pressure
+} Touch_Sample_t;
+
+typedef enum {
+    TOUCH_EVT_DOWN = 1,
+    TOUCH_EVT_MOVE,
+    TOUCH_EVT_UP
+} Touch_EventType_t;
+
+typedef struct {
+    uint8_t  type;      // Touch_EventType_t
+    int16_t  x, y;      // Screen coordinates
+    uint32_t tick;      // osKernelGetTickCount() at acquisition
+} Touch_Event_t;
+
+// Q16.16 affine map: x = (a*rx + b*ry + c) >> 16, y = (d*rx + e*ry + f) >> 16
+typedef struct {
+    int32_t a, b, c;
+    int32_t d, e, f;
+} Touch_Cal_t;
+
 void Touch_Init(void);
 int  Touch_GetCoord(int16_t *x, int16_t *y);
+int  Touch_PollEvents(Touch_Event_t *buf, int max);
+void Touch_FlushEvents(void);
+int  Touch_GetRaw(uint16_t *x, uint16_t *y);
+
+// --- Calibration ---
+void Touch_GetCalibration(Touch_Cal_t *cal);
+void Touch_SetCalibration(const Touch_Cal_t *cal);
+void Touch_ResetCalibration(void);
+int  Touch_SolveCalibration(const int16_t scr[3][2], uint16_t raw[3][2], Touch_Cal_t *cal);
+int  Touch_SaveCalibration(void);
 #endif
\ No newline at end of file
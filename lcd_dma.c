@@ -0,0 +1,154 @@
+#include "stm32f4xx.h"
+#include "lcd_dma.h"
+#include <stddef.h>
+
+/* =========================================================================
+   CONFIGURATION
+   ========================================================================= */
+// Memory-to-memory needs DMA2; the "peripheral" port is the pixel source,
+// the memory port the fixed FSMC data address
+#define LCD_DMA_STREAM          DMA2_Stream0
+#define LCD_DMA_IRQn            DMA2_Stream0_IRQn
+#define LCD_DMA_IRQ_PRIO        9U          // Below the audio stream
+#define LCD_DMA_MAX_CHUNK       0xFFFFU     // NDTR limit, longer runs are chained
+#define LCD_DMA_MIN_WORDS       16U         // Shorter runs: CPU stores are cheaper than set-up
+
+// Core-coupled RAM is not on the DMA bus matrix
+#define LCD_CCM_START           0x10000000UL
+#define LCD_CCM_END             0x10010000UL
+
+#define LCD_DMA_FLAGS           (DMA_LIFCR_CTCIF0 | DMA_LIFCR_CHTIF0 | DMA_LIFCR_CTEIF0 | \
+                                 DMA_LIFCR_CDMEIF0 | DMA_LIFCR_CFEIF0)
+
+static volatile uint8_t  lcd_busy;      // Cleared by the interrupt after the last chunk
+static const uint16_t   *lcd_src;       // Source of the next chunk
+static uint32_t          lcd_left;      // Words not yet handed to the stream
+static uint32_t          lcd_pinc;      // DMA_SxCR_PINC, or 0 for a constant source
+static uint16_t          lcd_color;     // Source word of constant fills
+
+/* Queue the next chunk (interrupt, or thread with the stream idle) */
+static void LCD_DMA_Next(void)
+{
+    DMA_Stream_TypeDef *s = LCD_DMA_STREAM;
+    uint32_t n = (lcd_left > LCD_DMA_MAX_CHUNK) ? LCD_DMA_MAX_CHUNK : lcd_left;
+
+    DMA2->LIFCR = LCD_DMA_FLAGS;
+    s->PAR  = (uint32_t)lcd_src;
+    s->M0AR = LCD_FSMC_DATA;
+    s->NDTR = n;
+    s->CR   = (0U << DMA_SxCR_CHSEL_Pos) | DMA_SxCR_PL_0 | DMA_SxCR_DIR_1 |
+              DMA_SxCR_MSIZE_0 | DMA_SxCR_PSIZE_0 | lcd_pinc |
+              DMA_SxCR_TCIE | DMA_SxCR_TEIE;
+    s->CR  |= DMA_SxCR_EN;
+
+    lcd_left -= n;
+    if (lcd_pinc) lcd_src += n;
+}
+
+static void LCD_DMA_Start(const uint16_t *src, uint32_t count, uint32_t pinc)
+{
+    lcd_src  = src;
+    lcd_left = count;
+    lcd_pinc = pinc;
+    lcd_busy = 1;
+    LCD_DMA_Next();
+}
+
+void DMA2_Stream0_IRQHandler(void)
+{
+    uint32_t isr = DMA2->LISR;
+
+    DMA2->LIFCR = LCD_DMA_FLAGS;
+
+    if ((isr & DMA_LISR_TEIF0) || (lcd_left == 0U)) {
+        lcd_left = 0;           // An error drops the rest of the run
+        lcd_busy = 0;
+        return;
+    }
+    if (isr & DMA_LISR_TCIF0) LCD_DMA_Next();
+}
+
+void LCD_DMA_Init(void)
+{
+    DMA_Stream_TypeDef *s = LCD_DMA_STREAM;
+
+    RCC->AHB1ENR |= RCC_AHB1ENR_DMA2EN;
+    (void)RCC->AHB1ENR;
+
+    s->CR &= ~DMA_SxCR_EN;
+    while (s->CR & DMA_SxCR_EN);
+    s->FCR = DMA_SxFCR_DMDIS | DMA_SxFCR_FTH;   // Memory-to-memory runs through the FIFO
+    lcd_busy = 0;
+
+    NVIC_SetPriority(LCD_DMA_IRQn, LCD_DMA_IRQ_PRIO);
+    NVIC_EnableIRQ(LCD_DMA_IRQn);
+}
+
+/* Every other access to the controller must wait for the pump first */
+void LCD_DMA_Wait(void)
+{
+    while (lcd_busy);
+}
+
+int LCD_DMA_Busy(void)
+{
+    return lcd_busy;
+}
+
+/*
+ * Stream `count` pixels of one colour into the open GRAM window. Returns
+ * at once: the stream reads a single source word without incrementing
+ * and the caller can work on while the run goes out.
+ */
+void LCD_DMA_Fill(uint16_t color, uint32_t count)
+{
+    volatile uint16_t *dat = (volatile uint16_t *)LCD_FSMC_DATA;
+
+    LCD_DMA_Wait();
+    if (count < LCD_DMA_MIN_WORDS) {
+        while (count--) *dat = color;
+        return;
+    }
+    lcd_color = color;
+    LCD_DMA_Start(&lcd_color, count, 0);
+}
+
+/*
+ * Stream `count` pixels from a buffer that stays put until the run is out,
+ * e.g. image data in flash. Returns at once like LCD_DMA_Fill.
+ */
+void LCD_DMA_Stream(const uint16_t *src, uint32_t count)
+{
+    volatile uint16_t *dat = (volatile uint16_t *)LCD_FSMC_DATA;
+
+    LCD_DMA_Wait();
+    if ((count < LCD_DMA_MIN_WORDS) ||
+        (((uint32_t)src >= LCD_CCM_START) && ((uint32_t)src < LCD_CCM_END))) {
+        while (count--) *dat = *src++;
+        return;
+    }
+    LCD_DMA_Start(src, count, DMA_SxCR_PINC);
+}
+
+/*
+ * pfWriteM16_A1 for GUIDRV_FlexColor. Solid runs (fills) go out as constant
+ * fills and return at once. Other runs come from emWin's line buffer, which
+ * it refills as soon as this returns, so those wait for the last chunk.
+ */
+void LCD_DMA_WriteM16(uint16_t *pData, int NumWords)
+{
+    uint32_t n = (NumWords > 0) ? (uint32_t)NumWords : 0U;
+    uint32_t i = 1;
+
+    if (n == 0U) return;
+
+    // A solid run mismatches within a word or two if it is not one
+    while ((i < n) && (pData[i] == pData[0])) i++;
+    if (i == n) {
+        LCD_DMA_Fill(pData[0], n);
+        return;
+    }
+
+    LCD_DMA_Stream(pData, n);
+    LCD_DMA_Wait();
+}
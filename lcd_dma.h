@@ -0,0 +1,20 @@
+#ifndef LCD_DMA_H
+#define LCD_DMA_H
+
+#include <stdint.h>
+
+// Panel data register on FSMC Bank1 NE4, RS on A0 (same as the LCD_X port); adjust to board wiring
+#define LCD_FSMC_DATA       0x6C000002UL
+
+void LCD_DMA_Init(void);
+void LCD_DMA_WriteM16(uint16_t *pData, int NumWords);
+void LCD_DMA_Fill(uint16_t color, uint32_t count);
+void LCD_DMA_Stream(const uint16_t *src, uint32_t count);
+void LCD_DMA_Wait(void);
+int  LCD_DMA_Busy(void);
+
+// Open a GRAM write window (RTE/Graphics/LCDConf_MCBQVGA_LG.c): the pixels
+// that follow fill it row by row, x0..x1 then the next line
+void LCD_X_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+#endif
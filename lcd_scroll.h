@@ -0,0 +1,13 @@
+#ifndef LCD_SCROLL_H
+#define LCD_SCROLL_H
+
+#include <stdint.h>
+
+// HX8347-D vertical scroll along the 320-line axis (RTE/Graphics/LCDConf_MCBQVGA_LG.c).
+// emWin knows nothing about it: drawing still addresses GRAM lines.
+#define LCD_SCROLL_LINES    320
+
+void LCD_X_SetScrollArea(uint16_t tfa, uint16_t vsa, uint16_t bfa);
+void LCD_X_SetScrollStart(uint16_t line);
+
+#endif
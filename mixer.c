@@ -0,0 +1,179 @@
+#include "stm32f4xx.h"
+#include "mixer.h"
+#include <stddef.h>
+#include <string.h>
+
+/* =========================================================================
+   IMA-ADPCM DECODER
+   ========================================================================= */
+static const int16_t ima_step[89] = {
+        7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+       19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+       50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+      130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+      337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+      876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+     2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+     5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t ima_index[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+/* =========================================================================
+   VOICES
+   ========================================================================= */
+typedef struct {
+    const Mixer_Clip_t *clip;
+    uint32_t nib;               // Next nibble to decode
+    uint32_t left;              // Source samples still to play, `cur` included
+    uint32_t phase;             // Q16 position between cur and next
+    uint32_t step;              // Q16 source samples per output frame
+    int32_t  pred;
+    int32_t  index;
+    int16_t  cur, next;
+    uint32_t gains;             // Q15 left gain (bottom) | right gain (top)
+    uint32_t age;               // Play order, for stealing the oldest voice
+    volatile uint8_t active;    // Written last: the render interrupt skips a voice being set up
+} Mixer_Voice_t;
+
+static Mixer_Voice_t voices[MIXER_VOICES];
+static uint32_t      mix_out_rate = 16000;
+static uint32_t      mix_age;
+
+static int16_t Mixer_Decode(Mixer_Voice_t *v) {
+    const Mixer_Clip_t *c = v->clip;
+
+    if (v->nib >= c->samples) return 0;     // Past the end: fade the last step to zero
+
+    uint32_t n    = (c->data[v->nib >> 1] >> ((v->nib & 1U) * 4U)) & 0xFU;
+    int32_t  step = ima_step[v->index];
+    int32_t  diff = step >> 3;
+
+    if (n & 4U) diff += step;
+    if (n & 2U) diff += step >> 1;
+    if (n & 1U) diff += step >> 2;
+    v->pred  = __SSAT((n & 8U) ? (v->pred - diff) : (v->pred + diff), 16);
+    v->index += ima_index[n];
+    if (v->index < 0)  v->index = 0;
+    if (v->index > 88) v->index = 88;
+    v->nib++;
+    return (int16_t)v->pred;
+}
+
+/* Balance law: centre is full volume on both sides */
+static uint32_t Mixer_Gains(uint16_t vol, int8_t pan) {
+    int32_t p  = (pan < MIXER_PAN_LEFT) ? MIXER_PAN_LEFT : (pan > MIXER_PAN_RIGHT) ? MIXER_PAN_RIGHT : pan;
+    uint32_t l = ((uint32_t)vol * (uint32_t)((p > 0) ? (64 - p) : 64)) >> 6;
+    uint32_t r = ((uint32_t)vol * (uint32_t)((p < 0) ? (64 + p) : 64)) >> 6;
+
+    if (l > MIXER_VOL_MAX) l = MIXER_VOL_MAX;
+    if (r > MIXER_VOL_MAX) r = MIXER_VOL_MAX;
+    return l | (r << 16);
+}
+
+void Mixer_Init(uint32_t out_rate) {
+    Mixer_StopAll();
+    if (out_rate != 0U) mix_out_rate = out_rate;
+}
+
+/*
+ * Start a clip on a free voice, or on the oldest one when all are busy.
+ * Returns the voice number for Mixer_SetVoice / Mixer_Stop.
+ */
+int Mixer_Play(const Mixer_Clip_t *clip, uint16_t vol, int8_t pan) {
+    int best = 0;
+
+    if ((clip == NULL) || (clip->samples == 0U)) return -1;
+
+    for (int i = 0; i < MIXER_VOICES; i++) {
+        if (!voices[i].active) { best = i; break; }
+        if ((mix_age - voices[i].age) > (mix_age - voices[best].age)) best = i;
+    }
+
+    Mixer_Voice_t *v = &voices[best];
+
+    v->active = 0;
+    __DMB();
+    v->clip   = clip;
+    v->nib    = 0;
+    v->left   = clip->samples;
+    v->phase  = 0;
+    v->step   = ((uint32_t)clip->rate << 16) / mix_out_rate;
+    v->pred   = 0;
+    v->index  = 0;
+    v->cur    = Mixer_Decode(v);
+    v->next   = Mixer_Decode(v);
+    v->gains  = Mixer_Gains(vol, pan);
+    v->age    = mix_age++;
+    __DMB();
+    v->active = 1;
+    return best;
+}
+
+/* One 32-bit store: the render interrupt sees the old or the new gains */
+void Mixer_SetVoice(int voice, uint16_t vol, int8_t pan) {
+    if ((voice < 0) || (voice >= MIXER_VOICES)) return;
+    voices[voice].gains = Mixer_Gains(vol, pan);
+}
+
+void Mixer_Stop(int voice) {
+    if ((voice < 0) || (voice >= MIXER_VOICES)) return;
+    voices[voice].active = 0;
+}
+
+void Mixer_StopAll(void) {
+    for (int i = 0; i < MIXER_VOICES; i++) voices[i].active = 0;
+}
+
+/* Voice still sounding this clip (it may have been stolen since) */
+int Mixer_IsPlaying(int voice, const Mixer_Clip_t *clip) {
+    if ((voice < 0) || (voice >= MIXER_VOICES)) return 0;
+    return voices[voice].active && (voices[voice].clip == clip);
+}
+
+/*
+ * Audio_Render_t for the I2S path. Per voice and frame:
+ *   __SMLAD  linear interpolation between two decoded samples (resampling)
+ *   __SMULBB/__SMULBT  Q15 left and right gains
+ *   __QADD16 saturating add of the packed L/R pair into the output
+ */
+void Mixer_Render(int16_t *buf, uint32_t frames) {
+    uint32_t *out = (uint32_t *)buf;
+
+    memset(out, 0, frames * sizeof(uint32_t));
+
+    for (int i = 0; i < MIXER_VOICES; i++) {
+        Mixer_Voice_t *v = &voices[i];
+
+        if (!v->active) continue;
+
+        uint32_t gains = v->gains;
+
+        for (uint32_t f = 0; f < frames; f++) {
+            uint32_t frac = (v->phase >> 1) & 0x7FFFU;
+            uint32_t pair = __PKHBT((uint32_t)(uint16_t)v->cur, (uint32_t)(uint16_t)v->next, 16);
+            uint32_t coef = (0x7FFFU - frac) | (frac << 16);
+            int32_t  s    = __SMLAD(pair, coef, 0x4000) >> 15;
+            int32_t  l    = __SMULBB((uint32_t)s, gains) >> 15;
+            int32_t  r    = __SMULBT((uint32_t)s, gains) >> 15;
+
+            out[f] = __QADD16(out[f], __PKHBT((uint32_t)l, (uint32_t)r, 16));
+
+            v->phase += v->step;
+            while (v->phase >= 0x10000U) {
+                v->phase -= 0x10000U;
+                if (--v->left == 0U) break;
+                v->cur  = v->next;
+                v->next = Mixer_Decode(v);
+            }
+            if (v->left == 0U) {
+                v->active = 0;
+                break;
+            }
+        }
+    }
+}
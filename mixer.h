@@ -0,0 +1,32 @@
+#ifndef MIXER_H
+#define MIXER_H
+
+#include <stdint.h>
+
+#define MIXER_VOICES        6
+
+// Mono 4-bit IMA-ADPCM in flash, low nibble first, decoder starts at 0 / index 0
+typedef struct {
+    const uint8_t *data;
+    uint32_t       samples;
+    uint16_t       rate;        // Hz
+} Mixer_Clip_t;
+
+#define MIXER_VOL_MAX       32767   // Q15 unity gain
+#define MIXER_PAN_LEFT      (-64)
+#define MIXER_PAN_CENTER    0
+#define MIXER_PAN_RIGHT     64
+
+void Mixer_Init(uint32_t out_rate);
+int  Mixer_Play(const Mixer_Clip_t *clip, uint16_t vol, int8_t pan);
+void Mixer_SetVoice(int voice, uint16_t vol, int8_t pan);
+void Mixer_Stop(int voice);
+void Mixer_StopAll(void);
+int  Mixer_IsPlaying(int voice, const Mixer_Clip_t *clip);
+void Mixer_Render(int16_t *buf, uint32_t frames);
+
+// Built-in effects (sfx_clips.c, generated by tools/adpcm_sfx.py)
+extern const Mixer_Clip_t sfx_clip_fruit;
+extern const Mixer_Clip_t sfx_clip_game_over;
+
+#endif
@@ -0,0 +1,231 @@
+#include "stm32f4xx.h"
+#include "music.h"
+#include "sound.h"
+#include <stddef.h>
+
+#include "cmsis_os2.h"
+
+#define MUSIC_DEFAULT_VOL   80U     // Leaves headroom for the effects on top
+
+/* =========================================================================
+   INSTRUMENTS
+   ========================================================================= */
+enum { WAVE_SQUARE50, WAVE_SQUARE25, WAVE_TRIANGLE, WAVE_NOISE };
+
+typedef struct {
+    uint8_t wave;
+    uint8_t vol;                // Attack level 0..255
+    uint8_t decay;              // Q8 envelope factor per render block (255 = slowest)
+} Music_Instr_t;
+
+static const Music_Instr_t music_instr[16] = {
+    [MUSIC_INS_LEAD]  = { WAVE_SQUARE50, 200, 250 },
+    [MUSIC_INS_BASS]  = { WAVE_TRIANGLE, 255, 253 },
+    [MUSIC_INS_PLUCK] = { WAVE_SQUARE25, 180, 225 },
+    [MUSIC_INS_DRUM]  = { WAVE_NOISE,    220, 170 }
+};
+
+/* Top octave (C7..B7) in mHz; lower octaves are right shifts */
+static const uint32_t music_freq7_mhz[12] = {
+    2093005, 2217461, 2349318, 2489016, 2637020, 2793826,
+    2959955, 3135963, 3322438, 3520000, 3729310, 3951066
+};
+
+/* =========================================================================
+   CHANNELS
+   ========================================================================= */
+// Fixed per channel whatever the song length: the song itself stays in flash
+typedef struct {
+    uint32_t phase;             // Oscillator position, one wave period = 2^32
+    uint32_t inc;               // Phase step per output frame of the note
+    uint32_t env;               // Q8 envelope level (attack << 8, decays per block)
+    uint16_t lfsr;              // Noise generator
+    uint8_t  note;              // Last triggered note, 1..96
+    uint8_t  ins;
+    uint8_t  fx, param;         // Effect of the current row
+    uint8_t  level;             // Channel volume, MUSIC_FX_VOLUME
+    uint8_t  arp;               // Arpeggio step 0..2
+    volatile uint8_t gate;      // Written last: the render interrupt skips a channel being set up
+} Music_Chan_t;
+
+static Music_Chan_t         chans[MUSIC_CHANNELS];
+static uint32_t             music_inc7[12];     // Phase steps of the top octave at the output rate
+static volatile uint8_t     music_vol = MUSIC_DEFAULT_VOL;
+
+static osTimerId_t          music_timer;
+static const Music_Song_t  *music_song;         // Timer thread only while the timer runs
+static uint8_t              music_order;
+static uint8_t              music_row;
+
+static uint32_t Music_NoteInc(uint32_t note) {
+    uint32_t n = note - 1U;
+
+    if ((note == 0U) || (n >= 96U)) return 0;
+    return music_inc7[n % 12U] >> (7U - n / 12U);
+}
+
+static uint16_t Music_NoteHz(uint32_t note) {
+    uint32_t n = note - 1U;
+
+    if ((note == 0U) || (n >= 96U)) return 0;
+    return (uint16_t)((music_freq7_mhz[n % 12U] >> (7U - n / 12U)) / 1000U);
+}
+
+/*
+ * Call before the output renders: notes already sounding (on the buzzer)
+ * are retuned to the new rate under the kernel lock, so the row timer
+ * never sees a half-written table.
+ */
+void Music_Init(uint32_t out_rate) {
+    if (out_rate == 0U) return;
+
+    int32_t lock = osKernelLock();
+
+    for (int i = 0; i < 12; i++) {
+        music_inc7[i] = (uint32_t)(((uint64_t)music_freq7_mhz[i] << 32) / ((uint64_t)out_rate * 1000U));
+    }
+    for (int i = 0; i < MUSIC_CHANNELS; i++) chans[i].inc = Music_NoteInc(chans[i].note);
+
+    osKernelRestoreLock(lock);
+}
+
+/* =========================================================================
+   ROW SEQUENCER (timer thread, once per row)
+   ========================================================================= */
+static void Music_Trigger(Music_Chan_t *c, uint8_t note) {
+    c->gate  = 0;
+    __DMB();
+    c->note  = note;
+    c->phase = 0;
+    c->arp   = 0;
+    c->inc   = Music_NoteInc(note);
+    c->env   = (uint32_t)music_instr[c->ins].vol << 8;
+    if (c->lfsr == 0U) c->lfsr = 0xACE1U;
+    __DMB();
+    c->gate  = (c->ins != 0U) && (note >= 1U) && (note <= 96U);    // Also on the buzzer, before Music_Init
+}
+
+static void Music_RowCb(void *arg) {
+    const Music_Song_t *song = music_song;
+
+    (void)arg;
+    if (song == NULL) return;
+
+    const Music_Cell_t *cell = song->patterns[song->order[music_order]] +
+                               (uint32_t)music_row * song->channels;
+
+    for (uint32_t ch = 0; (ch < song->channels) && (ch < MUSIC_CHANNELS); ch++) {
+        Music_Chan_t *c = &chans[ch];
+        uint8_t ins = cell[ch].ins_fx >> 4;
+
+        if (ins != 0U) c->ins = ins;
+        if ((cell[ch].note != 0U) || (cell[ch].ins_fx != 0U)) {
+            c->fx    = cell[ch].ins_fx & 0x0FU;
+            c->param = cell[ch].param;
+            if (c->fx == MUSIC_FX_VOLUME) c->level = c->param;
+        }
+
+        if (cell[ch].note == MUSIC_OFF) c->gate = 0;
+        else if (cell[ch].note != 0U)   Music_Trigger(c, cell[ch].note);
+    }
+
+    // No codec: the lead channel goes to the buzzer between sound effects
+    if (!Sound_PcmReady()) Sound_MusicTone(chans[0].gate ? Music_NoteHz(chans[0].note) : 0U);
+
+    if (++music_row >= song->rows) {
+        music_row = 0;
+        if (++music_order >= song->num_orders) music_order = song->loop_to;
+    }
+}
+
+/*
+ * Start a track from its first row and loop it until Music_Stop or the
+ * next Music_Play. Asking for the track already playing changes nothing.
+ */
+void Music_Play(const Music_Song_t *song) {
+    if ((song == NULL) || (song->num_orders == 0U) || (song->rows == 0U)) return;
+    if (song == music_song) return;
+
+    if (music_timer == NULL) {
+        Sound_Init();
+        music_timer = osTimerNew(Music_RowCb, osTimerPeriodic, NULL, NULL);
+        if (music_timer == NULL) return;
+    }
+
+    Music_Stop();
+    for (int i = 0; i < MUSIC_CHANNELS; i++) {
+        chans[i].ins   = 0;
+        chans[i].level = 255;
+    }
+    music_order = 0;
+    music_row   = 0;
+    music_song  = song;
+
+    Music_RowCb(NULL);
+    osTimerStart(music_timer, song->row_ms);
+}
+
+void Music_Stop(void) {
+    if (music_timer != NULL) osTimerStop(music_timer);
+    music_song = NULL;
+    for (int i = 0; i < MUSIC_CHANNELS; i++) chans[i].gate = 0;
+    if (!Sound_PcmReady()) Sound_MusicTone(0);
+}
+
+void Music_SetVolume(uint8_t vol) {
+    music_vol = vol;
+}
+
+/* =========================================================================
+   SYNTHESIS (audio DMA interrupt, added on top of the mixer output)
+   ========================================================================= */
+/*
+ * Envelope and arpeggio advance once per block, the oscillators per frame:
+ * a phase add, a waveform, one multiply and a saturating add per channel.
+ */
+void Music_Render(int16_t *buf, uint32_t frames) {
+    uint32_t *out = (uint32_t *)buf;
+    uint32_t  vol = music_vol;
+
+    for (int i = 0; i < MUSIC_CHANNELS; i++) {
+        Music_Chan_t *c = &chans[i];
+
+        if (!c->gate) continue;
+
+        const Music_Instr_t *ins = &music_instr[c->ins];
+        int32_t  gain  = (int32_t)(((c->env >> 8) * c->level * vol) >> 9);    // Q15
+        uint32_t phase = c->phase;
+        uint32_t inc   = c->inc;
+        uint32_t lfsr  = c->lfsr;
+
+        if (c->fx == MUSIC_FX_ARP) {
+            static const uint8_t shift[3] = { 0, 4, 0 };
+            uint32_t semi = (c->arp == 0U) ? 0U : (c->param >> shift[c->arp]) & 0x0FU;
+
+            inc    = Music_NoteInc(c->note + semi);
+            c->arp = (uint8_t)((c->arp + 1U) % 3U);
+        }
+
+        for (uint32_t f = 0; f < frames; f++) {
+            int32_t s;
+
+            switch (ins->wave) {
+            case WAVE_SQUARE25: s = (phase < 0x40000000U) ? 0x3FFF : -0x3FFF; break;
+            case WAVE_TRIANGLE: s = ((int32_t)((phase >> 31) ? ~phase : phase) >> 16) - 0x4000; break;
+            case WAVE_NOISE:    s = (lfsr & 1U) ? 0x3FFF : -0x3FFF; break;
+            default:            s = (phase < 0x80000000U) ? 0x3FFF : -0x3FFF; break;
+            }
+            s = (s * gain) >> 15;
+            out[f] = __QADD16(out[f], __PKHBT((uint32_t)s, (uint32_t)s, 16));
+
+            uint32_t next = phase + inc;
+            if (next < phase) lfsr = (lfsr >> 1) ^ ((0U - (lfsr & 1U)) & 0xB400U);
+            phase = next;
+        }
+
+        c->phase = phase;
+        c->lfsr  = (uint16_t)lfsr;
+        c->env   = (c->env * ins->decay) >> 8;
+        if (c->env < 0x100U) c->gate = 0;       // Decayed to silence
+    }
+}
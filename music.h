@@ -0,0 +1,56 @@
+#ifndef MUSIC_H
+#define MUSIC_H
+
+#include <stdint.h>
+
+#define MUSIC_CHANNELS      3
+
+// Notes: 0 = empty cell, 1..96 = C0..B7, MUSIC_OFF releases the channel
+enum { NOTE_C, NOTE_Cs, NOTE_D, NOTE_Ds, NOTE_E, NOTE_F,
+       NOTE_Fs, NOTE_G, NOTE_Gs, NOTE_A, NOTE_As, NOTE_B };
+#define MUSIC_NOTE(semi, oct)   ((uint8_t)((oct) * 12 + (semi) + 1))
+#define MUSIC_OFF               0x7F
+
+// Effects (low nibble of ins_fx) with their parameter byte; an empty cell
+// keeps the channel's running effect
+#define MUSIC_FX_NONE       0x0
+#define MUSIC_FX_VOLUME     0x1     // param = channel volume 0..255
+#define MUSIC_FX_ARP        0x2     // param = two semitone offsets (hi, lo nibble)
+
+// Instruments (high nibble of ins_fx), see music_instr[] in music.c
+#define MUSIC_INS_LEAD      1
+#define MUSIC_INS_BASS      2
+#define MUSIC_INS_PLUCK     3
+#define MUSIC_INS_DRUM      4
+
+// One channel of one row: 3 bytes in flash
+typedef struct {
+    uint8_t note;
+    uint8_t ins_fx;             // Instrument << 4 | effect, instrument 0 = keep
+    uint8_t param;
+} Music_Cell_t;
+
+typedef struct {
+    const Music_Cell_t *const *patterns;    // Each rows * channels cells, row-major
+    const uint8_t      *order;              // Pattern numbers in play order
+    uint8_t             num_orders;
+    uint8_t             loop_to;            // Order to jump to after the last one
+    uint8_t             channels;           // <= MUSIC_CHANNELS
+    uint8_t             rows;               // Rows per pattern
+    uint16_t            row_ms;             // Tempo
+} Music_Song_t;
+
+void Music_Init(uint32_t out_rate);
+void Music_Play(const Music_Song_t *song);
+void Music_Stop(void);
+void Music_SetVolume(uint8_t vol);
+void Music_Render(int16_t *buf, uint32_t frames);
+
+// Tracks (music_songs.c)
+extern const Music_Song_t song_menu;
+extern const Music_Song_t song_snake;
+extern const Music_Song_t song_brick;
+extern const Music_Song_t song_flappy;
+extern const Music_Song_t song_2048;
+
+#endif
@@ -0,0 +1,208 @@
+#include "music.h"
+
+/*
+ * Background tracks: 16-row patterns of lead, bass and drum cells, 3 bytes
+ * each, played straight from flash by music.c.
+ */
+#define N(n, o)             MUSIC_NOTE(NOTE_##n, o)
+#define X(n, o, ins)        { N(n, o), (MUSIC_INS_##ins << 4), 0 }
+#define XA(n, o, ins, p)    { N(n, o), (MUSIC_INS_##ins << 4) | MUSIC_FX_ARP, (p) }
+#define OFF                 { MUSIC_OFF, 0, 0 }
+#define ___                 { 0, 0, 0 }
+
+/* ===== MENU: C - Am - F - G ===== */
+static const Music_Cell_t menu_p0[16 * 3] = {
+    XA(C,5,PLUCK,0x47),  X(C,3,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    ___,                 X(C,3,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(E,5,PLUCK),        ___,                 ___,
+    ___,                 ___,                 ___,
+    XA(G,5,PLUCK,0x37),  X(A,2,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    ___,                 X(A,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(E,5,PLUCK),        ___,                 ___,
+    ___,                 ___,                 ___
+};
+
+static const Music_Cell_t menu_p1[16 * 3] = {
+    XA(F,5,PLUCK,0x48),  X(F,2,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    ___,                 X(F,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(A,5,PLUCK),        ___,                 ___,
+    ___,                 ___,                 ___,
+    XA(G,5,PLUCK,0x47),  X(G,2,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    X(D,5,PLUCK),        X(G,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(B,4,PLUCK),        ___,                 X(B,7,DRUM),
+    ___,                 ___,                 ___
+};
+
+static const Music_Cell_t *const menu_patterns[] = { menu_p0, menu_p1 };
+static const uint8_t menu_order[] = { 0, 1, 0, 1 };
+
+const Music_Song_t song_menu = {
+    .patterns = menu_patterns, .order = menu_order, .num_orders = 4, .loop_to = 0,
+    .channels = 3, .rows = 16, .row_ms = 150
+};
+
+/* ===== SNAKE ===== */
+static const Music_Cell_t snake_p0[16 * 3] = {
+    X(A,4,LEAD),         X(A,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(C,5,LEAD),         X(A,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(E,5,LEAD),         X(A,3,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(C,5,LEAD),         X(A,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(A,4,LEAD),         X(A,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(C,5,LEAD),         X(A,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(E,5,LEAD),         X(A,3,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(G,5,LEAD),         X(G,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 X(B,7,DRUM)
+};
+
+static const Music_Cell_t snake_p1[16 * 3] = {
+    X(F,4,LEAD),         X(F,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(A,4,LEAD),         X(F,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(C,5,LEAD),         X(F,3,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(A,4,LEAD),         X(F,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(G,4,LEAD),         X(G,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(B,4,LEAD),         X(G,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(D,5,LEAD),         X(G,3,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(B,4,LEAD),         X(G,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 X(B,7,DRUM)
+};
+
+static const Music_Cell_t *const snake_patterns[] = { snake_p0, snake_p1 };
+static const uint8_t snake_order[] = { 0, 0, 1, 0 };
+
+const Music_Song_t song_snake = {
+    .patterns = snake_patterns, .order = snake_order, .num_orders = 4, .loop_to = 0,
+    .channels = 3, .rows = 16, .row_ms = 120
+};
+
+/* ===== BRICK ===== */
+static const Music_Cell_t brick_p0[16 * 3] = {
+    X(E,5,PLUCK),        X(E,2,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(G,5,PLUCK),        ___,                 ___,
+    X(E,5,PLUCK),        ___,                 ___,
+    X(B,5,PLUCK),        X(E,3,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(A,5,PLUCK),        ___,                 ___,
+    X(G,5,PLUCK),        ___,                 ___,
+    X(Fs,5,PLUCK),       X(D,2,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(E,5,PLUCK),        ___,                 ___,
+    ___,                 ___,                 ___,
+    X(D,5,PLUCK),        X(D,3,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(E,5,PLUCK),        ___,                 X(C,6,DRUM),
+    ___,                 ___,                 ___
+};
+
+static const Music_Cell_t brick_p1[16 * 3] = {
+    X(C,5,PLUCK),        X(C,3,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(E,5,PLUCK),        ___,                 ___,
+    X(C,5,PLUCK),        ___,                 ___,
+    X(G,5,PLUCK),        X(C,3,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(Fs,5,PLUCK),       ___,                 ___,
+    X(E,5,PLUCK),        ___,                 ___,
+    X(D,5,PLUCK),        X(B,2,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(Fs,5,PLUCK),       ___,                 ___,
+    ___,                 ___,                 ___,
+    X(B,4,PLUCK),        X(B,2,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    ___,                 ___,                 X(C,6,DRUM),
+    ___,                 ___,                 ___
+};
+
+static const Music_Cell_t *const brick_patterns[] = { brick_p0, brick_p1 };
+static const uint8_t brick_order[] = { 0, 1 };
+
+const Music_Song_t song_brick = {
+    .patterns = brick_patterns, .order = brick_order, .num_orders = 2, .loop_to = 0,
+    .channels = 3, .rows = 16, .row_ms = 110
+};
+
+/* ===== FLAPPY ===== */
+static const Music_Cell_t flappy_p0[16 * 3] = {
+    X(D,5,LEAD),         X(D,3,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(Fs,5,LEAD),        ___,                 X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(A,5,LEAD),         X(A,2,BASS),         ___,
+    ___,                 ___,                 ___,
+    X(Fs,5,LEAD),        ___,                 X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(G,5,LEAD),         X(G,2,BASS),         X(C,6,DRUM),
+    ___,                 ___,                 ___,
+    X(B,5,LEAD),         ___,                 X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    X(A,5,LEAD),         X(A,2,BASS),         ___,
+    ___,                 ___,                 ___,
+    ___,                 ___,                 X(B,7,DRUM),
+    ___,                 ___,                 ___
+};
+
+static const Music_Cell_t *const flappy_patterns[] = { flappy_p0 };
+static const uint8_t flappy_order[] = { 0 };
+
+const Music_Song_t song_flappy = {
+    .patterns = flappy_patterns, .order = flappy_order, .num_orders = 1, .loop_to = 0,
+    .channels = 3, .rows = 16, .row_ms = 140
+};
+
+/* ===== 2048 ===== */
+static const Music_Cell_t g2048_p0[16 * 3] = {
+    XA(E,5,PLUCK,0x37),  X(A,2,BASS),         ___,
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    X(D,5,PLUCK),        ___,                 X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    XA(C,5,PLUCK,0x47),  X(F,2,BASS),         ___,
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    X(B,4,PLUCK),        X(G,2,BASS),         X(B,7,DRUM),
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___,
+    ___,                 ___,                 ___
+};
+
+static const Music_Cell_t *const g2048_patterns[] = { g2048_p0 };
+static const uint8_t g2048_order[] = { 0, 0 };
+
+const Music_Song_t song_2048 = {
+    .patterns = g2048_patterns, .order = g2048_order, .num_orders = 2, .loop_to = 0,
+    .channels = 3, .rows = 16, .row_ms = 200
+};
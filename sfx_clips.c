@@ -0,0 +1,228 @@
+/* Generated by tools/adpcm_sfx.py, do not edit */
+#include "mixer.h"
+
+static const uint8_t sfx_fruit_data[240] = {
+    0x70, 0xFF, 0x77, 0xFF, 0x66, 0xEB, 0x51, 0xC8, 0x48, 0xC1, 0x3A, 0xA4, 0x1D, 0x84, 0x8C, 0x14,
+    0xBB, 0x34, 0xCB, 0x51, 0xC8, 0x20, 0xC1, 0x28, 0xB2, 0x3B, 0xA5, 0x1B, 0x84, 0x8C, 0x04, 0x9B,
+    0x14, 0xAB, 0x43, 0xCB, 0x33, 0xDA, 0x41, 0xB9, 0x50, 0xB8, 0x48, 0xB0, 0x49, 0xC1, 0x49, 0xB1,
+    0x4A, 0xB1, 0x4A, 0xB2, 0x4B, 0xB2, 0x4B, 0xC3, 0x3A, 0xC3, 0x3B, 0xB4, 0x3B, 0xB5, 0x4B, 0xB2,
+    0x4B, 0xC3, 0x3A, 0xC3, 0x3A, 0xD3, 0x4A, 0xB1, 0x49, 0xC1, 0x49, 0xB0, 0x48, 0xC0, 0x30, 0xC8,
+    0x40, 0xB9, 0x41, 0xAA, 0x32, 0xCB, 0x14, 0x9B, 0x14, 0x8D, 0x84, 0x1B, 0x93, 0x1C, 0xA4, 0x3B,
+    0xD3, 0x49, 0xB0, 0x48, 0xB8, 0x31, 0xCA, 0x33, 0x9D, 0x04, 0x0C, 0x93, 0x2B, 0xB4, 0x4A, 0xC1,
+    0x48, 0xB9, 0x32, 0xBB, 0x06, 0x0B, 0x94, 0x2B, 0xC3, 0x5A, 0xB0, 0x30, 0xC9, 0x23, 0x8D, 0x83,
+    0x2C, 0xB2, 0x5A, 0xC0, 0x31, 0xBA, 0x14, 0x8C, 0x94, 0x3B, 0xC2, 0x48, 0xB9, 0x23, 0x9C, 0x85,
+    0x2B, 0xC2, 0x48, 0xB9, 0x32, 0x9C, 0x95, 0x2A, 0xC2, 0x48, 0xB9, 0x23, 0x0D, 0xA3, 0x5B, 0xB0,
+    0x40, 0x9B, 0x84, 0x2B, 0xD3, 0x48, 0xA9, 0x12, 0x0C, 0xA4, 0x4A, 0xB8, 0x23, 0x0D, 0xA3, 0x5B,
+    0xB8, 0x32, 0x8D, 0x94, 0x3A, 0xB8, 0x32, 0x8D, 0xA4, 0x4A, 0xC0, 0x12, 0x0B, 0xB4, 0x49, 0xB8,
+    0x13, 0x1D, 0xB2, 0x58, 0xAA, 0x84, 0x3B, 0xD1, 0x21, 0x8B, 0xA5, 0x39, 0xC8, 0x03, 0x2C, 0xC2,
+    0x30, 0x9B, 0x95, 0x3A, 0xC8, 0x13, 0x2D, 0xB1, 0x30, 0x8C, 0xA4, 0x49, 0xA9, 0x84, 0x3B, 0xC0,
+    0x12, 0x1C, 0xB2, 0x40, 0x8B, 0xB4, 0x48, 0x9A, 0x93, 0x4A, 0xB8, 0x03, 0x2C, 0xA0, 0x11, 0x1A,
+};
+
+const Mixer_Clip_t sfx_clip_fruit = { sfx_fruit_data, 480, 8000 };
+
+static const uint8_t sfx_game_over_data[3200] = {
+    0x70, 0x77, 0xB7, 0xFF, 0xFF, 0x50, 0x24, 0x82, 0xEB, 0xAC, 0x0A, 0x53, 0x34, 0x82, 0xEA, 0xAC,
+    0x0A, 0x52, 0x33, 0x01, 0xCB, 0xAD, 0x89, 0x32, 0x35, 0x82, 0xCA, 0xAC, 0x8A, 0x32, 0x26, 0x02,
+    0xC9, 0xCB, 0x99, 0x32, 0x44, 0x02, 0xB9, 0xBD, 0x8A, 0x40, 0x34, 0x12, 0xB9, 0xCD, 0x8A, 0x30,
+    0x53, 0x12, 0xA8, 0xBD, 0x9B, 0x30, 0x35, 0x23, 0xB8, 0xCD, 0xAA, 0x20, 0x44, 0x13, 0xA0, 0xCC,
+    0x9B, 0x28, 0x53, 0x23, 0xA1, 0xCC, 0xBB, 0x28, 0x63, 0x23, 0x90, 0xDB, 0xBB, 0x18, 0x53, 0x24,
+    0x91, 0xDA, 0xAB, 0x09, 0x53, 0x33, 0x81, 0xDB, 0xCB, 0x09, 0x42, 0x43, 0x01, 0xCA, 0xAC, 0x8A,
+    0x42, 0x24, 0x02, 0xC9, 0xAC, 0x9A, 0x32, 0x35, 0x12, 0xC9, 0xBC, 0x9A, 0x31, 0x45, 0x02, 0xA8,
+    0xCC, 0x9A, 0x20, 0x44, 0x12, 0xB0, 0xDB, 0x9B, 0x28, 0x44, 0x23, 0x98, 0xCC, 0xAB, 0x18, 0x44,
+    0x23, 0x90, 0xEB, 0xBA, 0x18, 0x43, 0x24, 0x81, 0xDB, 0xBB, 0x19, 0x52, 0x24, 0x81, 0xCA, 0xBB,
+    0x8A, 0x53, 0x34, 0x01, 0xCA, 0xBC, 0x89, 0x41, 0x34, 0x02, 0xC9, 0xBC, 0x8A, 0x40, 0x53, 0x02,
+    0xA8, 0xCC, 0x9A, 0x20, 0x44, 0x12, 0x98, 0xCC, 0x9A, 0x28, 0x53, 0x13, 0x90, 0xCC, 0x9B, 0x19,
+    0x44, 0x23, 0x90, 0xDB, 0xBB, 0x19, 0x63, 0x23, 0x81, 0xDA, 0xBB, 0x0A, 0x52, 0x34, 0x01, 0xCA,
+    0xAC, 0x8A, 0x41, 0x24, 0x12, 0xC9, 0xCB, 0x8B, 0x31, 0x35, 0x13, 0xB9, 0xCD, 0x9A, 0x20, 0x44,
+    0x12, 0xA0, 0xCC, 0xAA, 0x28, 0x34, 0x24, 0x90, 0xBC, 0xAC, 0x19, 0x53, 0x33, 0x91, 0xDB, 0xAC,
+    0x09, 0x52, 0x23, 0x82, 0xCA, 0xBC, 0x8A, 0x42, 0x34, 0x02, 0xC9, 0xBC, 0x9A, 0x41, 0x34, 0x12,
+    0xB8, 0xCD, 0x9A, 0x20, 0x44, 0x12, 0xA0, 0xBC, 0x9C, 0x18, 0x34, 0x24, 0x90, 0xBC, 0xAC, 0x08,
+    0x53, 0x23, 0x81, 0xDB, 0xBB, 0x0A, 0x53, 0x24, 0x02, 0xCA, 0xBC, 0x99, 0x32, 0x26, 0x12, 0xB9,
+    0xBD, 0x9A, 0x21, 0x45, 0x12, 0xA8, 0xCC, 0x9A, 0x10, 0x34, 0x33, 0xA0, 0xCD, 0xBA, 0x18, 0x34,
+    0x34, 0x80, 0xDB, 0xBB, 0x1A, 0x62, 0x23, 0x82, 0xCA, 0xBC, 0x8A, 0x42, 0x34, 0x12, 0xC9, 0xBC,
+    0x9B, 0x31, 0x36, 0x12, 0xA8, 0xBD, 0xAB, 0x20, 0x35, 0x24, 0xA0, 0xDB, 0xAB, 0x19, 0x44, 0x23,
+    0x81, 0xEB, 0xAB, 0x09, 0x42, 0x34, 0x01, 0xCA, 0xBC, 0x8A, 0x32, 0x36, 0x02, 0xB9, 0xCC, 0x9A,
+    0x20, 0x35, 0x13, 0xB0, 0xDC, 0xAA, 0x10, 0x53, 0x23, 0x90, 0xDB, 0x9C, 0x09, 0x43, 0x33, 0x92,
+    0xEA, 0xBB, 0x89, 0x42, 0x25, 0x02, 0xB9, 0xBD, 0x9A, 0x31, 0x35, 0x13, 0xB8, 0xCD, 0xAA, 0x20,
+    0x44, 0x22, 0x90, 0xCC, 0xAB, 0x18, 0x53, 0x33, 0x81, 0xEB, 0xAB, 0x0A, 0x52, 0x33, 0x02, 0xCA,
+    0xAD, 0x9A, 0x31, 0x35, 0x13, 0xB9, 0xBD, 0x9C, 0x20, 0x34, 0x24, 0x98, 0xBC, 0xAC, 0x18, 0x53,
+    0x23, 0x81, 0xDB, 0xAC, 0x09, 0x41, 0x24, 0x02, 0xBA, 0xBD, 0x9A, 0x41, 0x34, 0x12, 0xB8, 0xCD,
+    0x9A, 0x20, 0x53, 0x23, 0x98, 0xCC, 0xAB, 0x18, 0x53, 0x33, 0x81, 0xDB, 0xBC, 0x09, 0x42, 0x24,
+    0x02, 0xC9, 0xBC, 0x8A, 0x31, 0x35, 0x13, 0xB8, 0xCD, 0xAA, 0x10, 0x44, 0x13, 0xA1, 0xDB, 0xBB,
+    0x08, 0x63, 0x23, 0x82, 0xCB, 0xBC, 0x0A, 0x41, 0x34, 0x12, 0xC9, 0xBC, 0x9A, 0x30, 0x35, 0x14,
+    0x98, 0xCC, 0xAA, 0x18, 0x34, 0x24, 0x91, 0xDB, 0xBB, 0x09, 0x53, 0x43, 0x01, 0xBA, 0xBD, 0x8A,
+    0x31, 0x45, 0x02, 0xA8, 0xCC, 0x9A, 0x10, 0x34, 0x24, 0x98, 0xCB, 0xAC, 0x08, 0x43, 0x24, 0x81,
+    0xCA, 0xAC, 0x8A, 0x42, 0x43, 0x12, 0xB9, 0xBD, 0x9B, 0x30, 0x35, 0x14, 0xA0, 0xEB, 0xAA, 0x18,
+    0x43, 0x24, 0x91, 0xCA, 0xAC, 0x89, 0x42, 0x43, 0x02, 0xBA, 0xBD, 0x9A, 0x31, 0x35, 0x14, 0xA8,
+    0xBC, 0x9C, 0x18, 0x53, 0x23, 0x91, 0xDB, 0xAC, 0x09, 0x42, 0x43, 0x01, 0xB9, 0xBD, 0x9A, 0x31,
+    0x45, 0x02, 0xA0, 0xCC, 0x9A, 0x18, 0x34, 0x14, 0x91, 0xCB, 0xAC, 0x09, 0x52, 0x23, 0x02, 0xCA,
+    0xBC, 0x9A, 0x41, 0x34, 0x13, 0xA9, 0xCD, 0xAA, 0x10, 0x34, 0x24, 0x80, 0xDB, 0xBB, 0x09, 0x53,
+    0x43, 0x01, 0xBA, 0xBD, 0x8A, 0x40, 0x53, 0x12, 0xA8, 0xCC, 0x9A, 0x18, 0x34, 0x14, 0x91, 0xCB,
+    0xAC, 0x09, 0x42, 0x24, 0x02, 0xBA, 0xBD, 0x9A, 0x31, 0x45, 0x12, 0xA8, 0xBC, 0xAC, 0x10, 0x53,
+    0x23, 0x81, 0xEB, 0xAB, 0x89, 0x52, 0x33, 0x02, 0xC9, 0xCC, 0x8A, 0x20, 0x44, 0x12, 0xA0, 0xDB,
+    0xAB, 0x18, 0x53, 0x24, 0x80, 0xCA, 0xBB, 0x8A, 0x52, 0x24, 0x12, 0xB9, 0xBD, 0x9B, 0x30, 0x54,
+    0x22, 0xA0, 0xDB, 0xAB, 0x19, 0x53, 0x33, 0x82, 0xDA, 0xBC, 0x8A, 0x32, 0x35, 0x13, 0xB8, 0xBE,
+    0x9B, 0x28, 0x44, 0x33, 0x90, 0xEB, 0xAB, 0x09, 0x42, 0x34, 0x02, 0xBA, 0xBE, 0x8A, 0x30, 0x44,
+    0x13, 0xA8, 0xEB, 0xAA, 0x18, 0x52, 0x33, 0x80, 0xDA, 0xBB, 0x8A, 0x42, 0x25, 0x03, 0xA9, 0xBD,
+    0xAB, 0x20, 0x45, 0x22, 0x90, 0xDB, 0xAB, 0x09, 0x43, 0x25, 0x01, 0xC9, 0xCB, 0x8A, 0x21, 0x35,
+    0x22, 0xA8, 0xBD, 0xBB, 0x28, 0x44, 0x33, 0x81, 0xDB, 0xBC, 0x89, 0x32, 0x26, 0x12, 0xA9, 0xBD,
+    0xAA, 0x20, 0x44, 0x23, 0x90, 0xDB, 0xAC, 0x09, 0x33, 0x35, 0x01, 0xC9, 0xAC, 0x8B, 0x30, 0x44,
+    0x13, 0xA0, 0xCC, 0xAB, 0x18, 0x53, 0x33, 0x82, 0xDB, 0xAC, 0x8A, 0x31, 0x35, 0x13, 0xA9, 0xCD,
+    0x9A, 0x18, 0x34, 0x33, 0x91, 0xEB, 0xBB, 0x0A, 0x52, 0x43, 0x11, 0xB9, 0xCC, 0x9A, 0x20, 0x34,
+    0x33, 0xA0, 0xCC, 0xAC, 0x08, 0x42, 0x33, 0x02, 0xCA, 0xBC, 0x9B, 0x31, 0x45, 0x12, 0x98, 0xDB,
+    0xAA, 0x19, 0x43, 0x33, 0x82, 0xCB, 0xBC, 0x8A, 0x41, 0x33, 0x13, 0xA9, 0xCC, 0x8A, 0x10, 0x22,
+    0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x77, 0x77, 0xF8, 0xFF, 0x0C, 0x41, 0x34,
+    0x14, 0x98, 0xCD, 0xAC, 0x89, 0x41, 0x44, 0x23, 0x90, 0xCC, 0xCB, 0x8A, 0x30, 0x44, 0x23, 0x81,
+    0xCA, 0xCC, 0x9A, 0x18, 0x34, 0x34, 0x11, 0xB9, 0xBD, 0xAC, 0x09, 0x52, 0x33, 0x23, 0xA8, 0xDC,
+    0xBB, 0x8A, 0x41, 0x34, 0x24, 0x80, 0xDA, 0xBB, 0x9B, 0x20, 0x54, 0x33, 0x01, 0xC9, 0xBC, 0x9C,
+    0x19, 0x42, 0x34, 0x12, 0xA8, 0xCC, 0xBB, 0x8A, 0x42, 0x44, 0x13, 0x91, 0xCB, 0xBC, 0x9B, 0x20,
+    0x45, 0x23, 0x82, 0xC9, 0xBC, 0xBB, 0x18, 0x63, 0x43, 0x12, 0xA8, 0xCC, 0xAB, 0x0A, 0x41, 0x34,
+    0x33, 0x90, 0xEB, 0xCB, 0x9A, 0x11, 0x44, 0x23, 0x82, 0xC9, 0xBC, 0xBB, 0x18, 0x63, 0x43, 0x02,
+    0x98, 0xCC, 0xAB, 0x89, 0x41, 0x34, 0x23, 0x91, 0xEB, 0xCB, 0x8A, 0x10, 0x44, 0x32, 0x01, 0xB9,
+    0xBE, 0x9B, 0x19, 0x52, 0x34, 0x12, 0xA8, 0xCC, 0xBB, 0x8A, 0x32, 0x36, 0x14, 0x91, 0xBA, 0xBD,
+    0x9B, 0x28, 0x35, 0x34, 0x01, 0xC8, 0xDB, 0xAA, 0x09, 0x42, 0x34, 0x13, 0xA0, 0xCC, 0xCB, 0x99,
+    0x21, 0x35, 0x33, 0x81, 0xDA, 0xBC, 0x9B, 0x18, 0x44, 0x43, 0x02, 0xB8, 0xCC, 0xAB, 0x89, 0x42,
+    0x44, 0x12, 0x80, 0xCB, 0xBC, 0x9A, 0x30, 0x44, 0x24, 0x81, 0xB9, 0xCC, 0x9B, 0x19, 0x52, 0x43,
+    0x12, 0x98, 0xCC, 0xAB, 0x8A, 0x31, 0x45, 0x23, 0x80, 0xCA, 0xBC, 0xAB, 0x28, 0x54, 0x33, 0x02,
+    0xB9, 0xDC, 0xAB, 0x09, 0x41, 0x34, 0x14, 0x90, 0xCA, 0xBC, 0x9A, 0x30, 0x44, 0x33, 0x82, 0xC9,
+    0xCC, 0x9B, 0x19, 0x42, 0x34, 0x13, 0xA0, 0xCC, 0xAC, 0x8A, 0x30, 0x44, 0x33, 0x81, 0xDA, 0xCB,
+    0x9B, 0x18, 0x53, 0x24, 0x12, 0xA8, 0xCC, 0xBB, 0x0A, 0x41, 0x44, 0x22, 0x80, 0xCA, 0xBC, 0x9B,
+    0x28, 0x44, 0x24, 0x02, 0xA9, 0xCC, 0xBB, 0x09, 0x42, 0x44, 0x22, 0x90, 0xCB, 0xBC, 0x9A, 0x20,
+    0x44, 0x24, 0x01, 0xA9, 0xBD, 0xAB, 0x09, 0x52, 0x34, 0x22, 0xA0, 0xDB, 0xBC, 0x8A, 0x20, 0x35,
+    0x24, 0x01, 0xC9, 0xDB, 0xAA, 0x08, 0x43, 0x43, 0x13, 0xA0, 0xCC, 0xCB, 0x89, 0x20, 0x44, 0x23,
+    0x01, 0xCA, 0xBC, 0xAB, 0x19, 0x63, 0x43, 0x12, 0xA8, 0xDB, 0xBB, 0x9A, 0x41, 0x34, 0x24, 0x01,
+    0xCA, 0xBC, 0xAB, 0x18, 0x53, 0x34, 0x13, 0xA8, 0xDC, 0xAB, 0x8A, 0x31, 0x35, 0x24, 0x81, 0xBA,
+    0xBE, 0xAA, 0x18, 0x53, 0x43, 0x12, 0xA8, 0xEB, 0xAB, 0x8A, 0x31, 0x35, 0x24, 0x81, 0xBA, 0xCD,
+    0xAA, 0x18, 0x43, 0x34, 0x12, 0x98, 0xBD, 0xAC, 0x8A, 0x30, 0x45, 0x22, 0x81, 0xC9, 0xBC, 0x9B,
+    0x19, 0x63, 0x33, 0x13, 0xA8, 0xDC, 0xBB, 0x8A, 0x31, 0x45, 0x23, 0x81, 0xC9, 0xBC, 0x9C, 0x19,
+    0x42, 0x34, 0x12, 0xA0, 0xEB, 0xBB, 0x8A, 0x30, 0x45, 0x32, 0x01, 0xC9, 0xBC, 0xBB, 0x19, 0x53,
+    0x34, 0x13, 0x90, 0xCC, 0xAC, 0x9A, 0x20, 0x44, 0x33, 0x02, 0xC9, 0xCC, 0xAA, 0x09, 0x41, 0x34,
+    0x23, 0x80, 0xCC, 0xCB, 0x9A, 0x28, 0x44, 0x33, 0x02, 0xC8, 0xDB, 0xBB, 0x89, 0x42, 0x34, 0x24,
+    0x80, 0xCA, 0xBC, 0x9B, 0x18, 0x44, 0x43, 0x02, 0x98, 0xCC, 0xBB, 0x99, 0x32, 0x45, 0x23, 0x81,
+    0xCA, 0xBC, 0xBB, 0x18, 0x53, 0x25, 0x22, 0x98, 0xBC, 0xBC, 0x9A, 0x30, 0x35, 0x34, 0x01, 0xB9,
+    0xCD, 0xAB, 0x88, 0x42, 0x34, 0x23, 0x91, 0xEB, 0xCB, 0x9A, 0x10, 0x34, 0x34, 0x02, 0xB8, 0xCC,
+    0xAC, 0x89, 0x31, 0x44, 0x23, 0x81, 0xCA, 0xCC, 0x9A, 0x19, 0x43, 0x34, 0x12, 0xA0, 0xCC, 0xCB,
+    0x99, 0x20, 0x44, 0x33, 0x01, 0xB9, 0xBE, 0xAB, 0x0A, 0x43, 0x35, 0x22, 0x91, 0xDB, 0xBC, 0x9A,
+    0x28, 0x53, 0x34, 0x02, 0xA8, 0xCC, 0xBB, 0x8A, 0x31, 0x36, 0x24, 0x00, 0xBA, 0xCC, 0xAB, 0x19,
+    0x52, 0x43, 0x13, 0x90, 0xDB, 0xAC, 0x9A, 0x28, 0x44, 0x33, 0x02, 0xB8, 0xCD, 0xBB, 0x89, 0x41,
+    0x44, 0x22, 0x81, 0xCA, 0xDB, 0xAA, 0x18, 0x42, 0x34, 0x22, 0x98, 0xCC, 0xBB, 0x9B, 0x30, 0x45,
+    0x33, 0x12, 0xC9, 0xBC, 0xBC, 0x89, 0x32, 0x36, 0x23, 0x81, 0xCB, 0xBD, 0xAA, 0x18, 0x43, 0x35,
+    0x12, 0xA0, 0xDB, 0xAC, 0x9A, 0x20, 0x44, 0x33, 0x02, 0xB9, 0xCD, 0xBB, 0x89, 0x42, 0x34, 0x24,
+    0x80, 0xBA, 0xCD, 0x9A, 0x19, 0x42, 0x34, 0x22, 0xA0, 0xEB, 0xBB, 0x9A, 0x20, 0x54, 0x23, 0x12,
+    0xA9, 0xCD, 0xAB, 0x89, 0x31, 0x45, 0x22, 0x01, 0xCA, 0xDB, 0xAA, 0x19, 0x42, 0x34, 0x13, 0x90,
+    0xDB, 0xBC, 0xAA, 0x20, 0x63, 0x33, 0x12, 0xA8, 0xCD, 0xAB, 0x9A, 0x31, 0x45, 0x23, 0x01, 0xB9,
+    0xBE, 0xAB, 0x09, 0x42, 0x44, 0x22, 0x80, 0xCA, 0xBC, 0xAB, 0x18, 0x44, 0x43, 0x12, 0xA0, 0xDB,
+    0xAC, 0x9A, 0x20, 0x44, 0x33, 0x02, 0xA9, 0xCD, 0xAB, 0x8A, 0x41, 0x53, 0x23, 0x81, 0xC9, 0xBC,
+    0xBB, 0x08, 0x52, 0x34, 0x23, 0x80, 0xEB, 0xBB, 0xAB, 0x28, 0x44, 0x34, 0x12, 0x98, 0xCC, 0xAC,
+    0x8A, 0x20, 0x63, 0x32, 0x11, 0xB9, 0xCC, 0xBB, 0x89, 0x41, 0x34, 0x24, 0x01, 0xCA, 0xDB, 0xAA,
+    0x09, 0x42, 0x34, 0x23, 0x90, 0xCB, 0xBD, 0xAA, 0x18, 0x34, 0x35, 0x12, 0x98, 0xBC, 0xAD, 0x9A,
+    0x20, 0x53, 0x24, 0x02, 0xA8, 0xCC, 0xBB, 0x89, 0x21, 0x45, 0x23, 0x01, 0xB9, 0xCD, 0xAB, 0x88,
+    0x32, 0x45, 0x22, 0x91, 0xC9, 0xBC, 0xAA, 0x19, 0x43, 0x25, 0x13, 0x80, 0xDB, 0xAC, 0xAA, 0x10,
+    0x53, 0x43, 0x02, 0xA0, 0xDB, 0xBB, 0x9A, 0x20, 0x45, 0x33, 0x11, 0xB9, 0xDC, 0xBA, 0x99, 0x31,
+    0x35, 0x24, 0x01, 0xB9, 0xBD, 0xBB, 0x09, 0x42, 0x44, 0x22, 0x81, 0xCA, 0xDB, 0xAA, 0x18, 0x32,
+    0x35, 0x13, 0x91, 0xDB, 0xAC, 0x9B, 0x28, 0x52, 0x33, 0x13, 0x98, 0xCC, 0xBB, 0x9B, 0x20, 0x35,
+    0x24, 0x11, 0xA9, 0xCB, 0xAB, 0x09, 0x31, 0x23, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x77, 0x77, 0x37, 0xFF, 0xAB, 0x9B, 0x21, 0x56, 0x43, 0x23, 0x80, 0xDB, 0xBD, 0xBC, 0x8A,
+    0x30, 0x45, 0x24, 0x22, 0x80, 0xCB, 0xBC, 0xAC, 0x8A, 0x20, 0x44, 0x43, 0x13, 0x81, 0xCA, 0xBC,
+    0xAC, 0x9A, 0x10, 0x44, 0x43, 0x22, 0x01, 0xBA, 0xCD, 0xBB, 0x9A, 0x28, 0x53, 0x44, 0x22, 0x01,
+    0xA9, 0xCC, 0xAC, 0xAA, 0x18, 0x42, 0x44, 0x22, 0x02, 0xA8, 0xCC, 0xCB, 0xAA, 0x08, 0x41, 0x34,
+    0x24, 0x12, 0xA8, 0xDB, 0xBC, 0xAB, 0x09, 0x41, 0x44, 0x23, 0x13, 0x90, 0xEB, 0xCB, 0xAB, 0x89,
+    0x21, 0x35, 0x25, 0x22, 0x80, 0xBB, 0xBE, 0xBB, 0x8A, 0x20, 0x54, 0x43, 0x22, 0x81, 0xC9, 0xDB,
+    0xBB, 0x9A, 0x10, 0x53, 0x34, 0x24, 0x01, 0xB9, 0xCC, 0xBB, 0xAB, 0x08, 0x53, 0x44, 0x23, 0x02,
+    0xA8, 0xEB, 0xCB, 0xAA, 0x09, 0x32, 0x35, 0x34, 0x12, 0x90, 0xEB, 0xCB, 0xAA, 0x8A, 0x31, 0x44,
+    0x34, 0x12, 0x91, 0xCA, 0xCC, 0xBA, 0x8A, 0x10, 0x44, 0x43, 0x23, 0x01, 0xBA, 0xCD, 0xBB, 0xAB,
+    0x10, 0x53, 0x44, 0x32, 0x01, 0xA8, 0xCC, 0xAC, 0xAB, 0x08, 0x41, 0x44, 0x32, 0x12, 0xA0, 0xDB,
+    0xBC, 0xBB, 0x89, 0x31, 0x45, 0x24, 0x13, 0x80, 0xCA, 0xCC, 0xBA, 0x8A, 0x10, 0x44, 0x43, 0x23,
+    0x81, 0xB9, 0xCD, 0xBB, 0x9B, 0x18, 0x53, 0x34, 0x24, 0x02, 0xA8, 0xEB, 0xBB, 0x9C, 0x09, 0x31,
+    0x54, 0x32, 0x22, 0x98, 0xDA, 0xBC, 0xBB, 0x8A, 0x21, 0x45, 0x43, 0x22, 0x81, 0xBA, 0xCD, 0xBB,
+    0x9A, 0x18, 0x44, 0x53, 0x22, 0x02, 0xA9, 0xCC, 0xCB, 0xAA, 0x88, 0x42, 0x53, 0x33, 0x12, 0x90,
+    0xCC, 0xDB, 0xAA, 0x99, 0x21, 0x44, 0x43, 0x22, 0x80, 0xC9, 0xDB, 0xBB, 0x9A, 0x28, 0x53, 0x34,
+    0x24, 0x01, 0xA8, 0xCC, 0xCB, 0xAA, 0x88, 0x32, 0x45, 0x33, 0x12, 0x90, 0xBC, 0xCD, 0xAA, 0x99,
+    0x21, 0x63, 0x33, 0x23, 0x81, 0xCA, 0xCC, 0xCB, 0x8A, 0x08, 0x43, 0x34, 0x33, 0x12, 0xB8, 0xCD,
+    0xCB, 0xAB, 0x09, 0x31, 0x45, 0x43, 0x12, 0x90, 0xCA, 0xDB, 0xAB, 0x9A, 0x20, 0x44, 0x43, 0x23,
+    0x01, 0xB9, 0xCD, 0xBB, 0xAB, 0x19, 0x52, 0x44, 0x23, 0x12, 0x98, 0xDB, 0xBC, 0xBB, 0x8A, 0x31,
+    0x45, 0x43, 0x13, 0x81, 0xC9, 0xBC, 0xBC, 0x9A, 0x18, 0x43, 0x35, 0x33, 0x12, 0xB8, 0xDC, 0xCB,
+    0xAB, 0x89, 0x32, 0x54, 0x33, 0x23, 0x80, 0xCB, 0xCD, 0xBA, 0x9A, 0x10, 0x53, 0x34, 0x33, 0x02,
+    0xB9, 0xDC, 0xAC, 0xAB, 0x88, 0x32, 0x45, 0x33, 0x13, 0x90, 0xCB, 0xCD, 0xBA, 0x99, 0x10, 0x44,
+    0x43, 0x32, 0x01, 0xB9, 0xDC, 0xBB, 0xAB, 0x09, 0x43, 0x44, 0x24, 0x12, 0x90, 0xCA, 0xCC, 0xBA,
+    0x99, 0x20, 0x34, 0x35, 0x23, 0x01, 0xB9, 0xCD, 0xCB, 0x9A, 0x09, 0x32, 0x45, 0x33, 0x12, 0x90,
+    0xDB, 0xBC, 0xAC, 0x8A, 0x20, 0x53, 0x34, 0x32, 0x01, 0xB9, 0xCD, 0xCB, 0x9A, 0x09, 0x32, 0x35,
+    0x34, 0x13, 0x90, 0xDB, 0xBC, 0xAC, 0x99, 0x10, 0x34, 0x35, 0x32, 0x01, 0xA9, 0xCD, 0xBB, 0x9C,
+    0x09, 0x31, 0x35, 0x34, 0x13, 0x80, 0xCB, 0xBD, 0xAC, 0x8A, 0x18, 0x53, 0x43, 0x33, 0x11, 0xA9,
+    0xDC, 0xBB, 0xAC, 0x88, 0x31, 0x44, 0x24, 0x13, 0x81, 0xCA, 0xBC, 0xBC, 0x9A, 0x18, 0x52, 0x34,
+    0x33, 0x03, 0xA8, 0xCC, 0xBD, 0xBA, 0x89, 0x21, 0x35, 0x25, 0x23, 0x81, 0xB9, 0xCD, 0xBB, 0xAB,
+    0x08, 0x43, 0x35, 0x34, 0x12, 0x88, 0xDB, 0xBC, 0xBB, 0x9A, 0x20, 0x35, 0x35, 0x33, 0x01, 0xB8,
+    0xCD, 0xCB, 0xAA, 0x89, 0x41, 0x53, 0x33, 0x13, 0x81, 0xCB, 0xBD, 0xAC, 0xAA, 0x18, 0x43, 0x35,
+    0x33, 0x12, 0xA8, 0xEB, 0xBC, 0xAB, 0x9A, 0x21, 0x45, 0x43, 0x22, 0x01, 0xB9, 0xCC, 0xBC, 0xAA,
+    0x09, 0x32, 0x45, 0x24, 0x12, 0x80, 0xBA, 0xBE, 0xBB, 0xAA, 0x10, 0x63, 0x43, 0x33, 0x12, 0xA8,
+    0xCC, 0xBC, 0xBB, 0x8A, 0x30, 0x45, 0x24, 0x23, 0x01, 0xB9, 0xDC, 0xCB, 0x9A, 0x09, 0x31, 0x35,
+    0x34, 0x13, 0x80, 0xCA, 0xBD, 0xCB, 0x9A, 0x18, 0x43, 0x44, 0x32, 0x02, 0xA0, 0xDB, 0xBC, 0xBB,
+    0x8A, 0x20, 0x45, 0x43, 0x23, 0x01, 0xB8, 0xDC, 0xBB, 0xBB, 0x89, 0x32, 0x46, 0x33, 0x23, 0x81,
+    0xCA, 0xBD, 0xBC, 0xAA, 0x18, 0x42, 0x44, 0x33, 0x22, 0x88, 0xDB, 0xCC, 0xBA, 0x8A, 0x18, 0x53,
+    0x34, 0x33, 0x02, 0xA8, 0xCC, 0xCC, 0xAA, 0x99, 0x21, 0x63, 0x33, 0x33, 0x01, 0xB9, 0xDD, 0xBB,
+    0xAB, 0x89, 0x32, 0x46, 0x33, 0x22, 0x81, 0xC9, 0xBD, 0xAC, 0x9B, 0x19, 0x42, 0x34, 0x34, 0x13,
+    0x90, 0xDA, 0xBC, 0xAC, 0x9A, 0x18, 0x43, 0x35, 0x23, 0x13, 0xA8, 0xEB, 0xDB, 0xAA, 0x8A, 0x10,
+    0x34, 0x44, 0x23, 0x01, 0xA8, 0xCC, 0xCB, 0xAB, 0x8A, 0x31, 0x54, 0x33, 0x24, 0x00, 0xA9, 0xCC,
+    0xBC, 0xAA, 0x09, 0x31, 0x45, 0x33, 0x23, 0x81, 0xD9, 0xDB, 0xBB, 0xAB, 0x19, 0x42, 0x35, 0x34,
+    0x22, 0x90, 0xCA, 0xCC, 0xBB, 0xAA, 0x18, 0x52, 0x44, 0x32, 0x12, 0x90, 0xCB, 0xBD, 0xBB, 0x9B,
+    0x10, 0x44, 0x34, 0x24, 0x12, 0x98, 0xDB, 0xBC, 0xBB, 0x8A, 0x20, 0x63, 0x34, 0x33, 0x11, 0xA8,
+    0xBD, 0xBD, 0xAB, 0x8A, 0x20, 0x35, 0x35, 0x23, 0x02, 0xA9, 0xBD, 0xBD, 0xAB, 0x89, 0x30, 0x35,
+    0x35, 0x32, 0x01, 0xB9, 0xBD, 0xBD, 0xAA, 0x0A, 0x31, 0x54, 0x43, 0x22, 0x00, 0xB9, 0xCC, 0xAC,
+    0xAB, 0x09, 0x31, 0x45, 0x33, 0x14, 0x81, 0xB9, 0xCC, 0xAC, 0xAB, 0x08, 0x31, 0x45, 0x33, 0x23,
+    0x81, 0xCA, 0xDC, 0xBA, 0xAB, 0x08, 0x32, 0x36, 0x34, 0x22, 0x91, 0xC9, 0xCC, 0xBB, 0x9B, 0x09,
+    0x52, 0x53, 0x33, 0x13, 0x81, 0xCB, 0xCC, 0xAC, 0xAA, 0x18, 0x41, 0x53, 0x33, 0x22, 0x80, 0xDA,
+    0xDB, 0xBB, 0xAA, 0x08, 0x43, 0x44, 0x24, 0x12, 0x80, 0xBA, 0xCD, 0xBB, 0x9A, 0x19, 0x42, 0x35,
+    0x43, 0x22, 0x90, 0xBA, 0xBE, 0xAC, 0xAA, 0x08, 0x42, 0x44, 0x32, 0x13, 0x80, 0xCA, 0xCC, 0xBB,
+    0xAB, 0x08, 0x43, 0x35, 0x34, 0x22, 0x80, 0xCA, 0xCC, 0xBB, 0xAB, 0x08, 0x52, 0x34, 0x34, 0x22,
+    0x80, 0xCA, 0xCC, 0xBB, 0x9B, 0x09, 0x42, 0x35, 0x34, 0x22, 0x80, 0xC9, 0xCC, 0xBB, 0xAA, 0x09,
+    0x32, 0x46, 0x33, 0x13, 0x01, 0xCA, 0xCC, 0xCB, 0xAA, 0x88, 0x22, 0x35, 0x25, 0x22, 0x81, 0xA9,
+    0xBD, 0xBC, 0xAB, 0x0A, 0x31, 0x36, 0x34, 0x23, 0x82, 0xB9, 0xCD, 0xAC, 0xAB, 0x89, 0x21, 0x35,
+    0x25, 0x23, 0x02, 0xA9, 0xBD, 0xAD, 0xAB, 0x8A, 0x30, 0x44, 0x34, 0x23, 0x12, 0xA9, 0xDC, 0xCB,
+    0xAB, 0x8A, 0x20, 0x63, 0x43, 0x23, 0x02, 0xA0, 0xDB, 0xCC, 0xAA, 0x9A, 0x10, 0x43, 0x44, 0x23,
+    0x22, 0x98, 0xDB, 0xDB, 0xAB, 0x9B, 0x18, 0x43, 0x35, 0x24, 0x12, 0x80, 0xCA, 0xBC, 0xBC, 0xAA,
+    0x08, 0x42, 0x44, 0x33, 0x23, 0x81, 0xCB, 0xCC, 0xAC, 0x9B, 0x09, 0x31, 0x35, 0x25, 0x23, 0x81,
+    0xB9, 0xCC, 0xBC, 0xAB, 0x89, 0x21, 0x45, 0x43, 0x32, 0x01, 0xB8, 0xEB, 0xCB, 0xAB, 0x99, 0x20,
+    0x44, 0x43, 0x33, 0x12, 0xA8, 0xEB, 0xCB, 0xBB, 0xAA, 0x10, 0x53, 0x44, 0x23, 0x22, 0x88, 0xCB,
+    0xCC, 0xBB, 0x9B, 0x19, 0x42, 0x35, 0x34, 0x22, 0x81, 0xCA, 0xBC, 0xAD, 0x9B, 0x09, 0x21, 0x35,
+    0x25, 0x23, 0x81, 0xB8, 0xCC, 0xBC, 0xBA, 0x89, 0x20, 0x54, 0x33, 0x24, 0x12, 0xA8, 0xDB, 0xBC,
+    0xAC, 0x99, 0x18, 0x43, 0x44, 0x32, 0x12, 0x90, 0xCA, 0xCC, 0xBB, 0x9B, 0x09, 0x43, 0x44, 0x24,
+    0x22, 0x81, 0xB9, 0xCD, 0xBB, 0xAB, 0x89, 0x31, 0x36, 0x34, 0x33, 0x02, 0xA9, 0xCD, 0xCB, 0xBB,
+    0x99, 0x20, 0x63, 0x43, 0x33, 0x12, 0x98, 0xDB, 0xBC, 0xBC, 0x9A, 0x18, 0x42, 0x44, 0x33, 0x22,
+    0x81, 0xCA, 0xCC, 0xCB, 0xAA, 0x09, 0x21, 0x35, 0x34, 0x33, 0x01, 0xB8, 0xCD, 0xCB, 0xAB, 0x9A,
+    0x20, 0x44, 0x53, 0x32, 0x12, 0x98, 0xDA, 0xDB, 0xBA, 0x9A, 0x08, 0x42, 0x34, 0x34, 0x23, 0x81,
+    0xCA, 0xBC, 0xBD, 0xAA, 0x89, 0x21, 0x35, 0x25, 0x23, 0x02, 0xA8, 0xEB, 0xCB, 0xAB, 0x9A, 0x10,
+    0x53, 0x34, 0x43, 0x12, 0x90, 0xBA, 0xBE, 0xCB, 0xAA, 0x08, 0x31, 0x45, 0x33, 0x23, 0x01, 0xB9,
+    0xCD, 0xAC, 0xBB, 0x99, 0x11, 0x44, 0x34, 0x33, 0x13, 0x98, 0xCC, 0xBC, 0xAC, 0x9A, 0x19, 0x32,
+    0x36, 0x43, 0x22, 0x81, 0xB9, 0xBD, 0xAD, 0xAB, 0x89, 0x21, 0x44, 0x43, 0x23, 0x12, 0xA8, 0xDB,
+    0xBC, 0xAC, 0x9A, 0x08, 0x43, 0x34, 0x34, 0x22, 0x80, 0xC9, 0xBC, 0xBC, 0xAB, 0x89, 0x21, 0x45,
+    0x43, 0x32, 0x01, 0x98, 0xBC, 0xBD, 0xBB, 0x9A, 0x10, 0x43, 0x35, 0x24, 0x22, 0x80, 0xBA, 0xBD,
+    0xBC, 0xAA, 0x89, 0x31, 0x44, 0x24, 0x23, 0x01, 0x99, 0xDB, 0xBB, 0xAB, 0x8A, 0x21, 0x43, 0x23,
+};
+
+const Mixer_Clip_t sfx_clip_game_over = { sfx_game_over_data, 6400, 8000 };
+
@@ -3,7 +3,11 @@
 #include "LCD.h"
 #include "cmsis_os2.h"
 #include "input.h"
+#include "game_input.h"
 #include "sound.h"
+#include "music.h"
+#include "compositor.h"
+#include "sprite.h"
 #include <stdint.h>
 #include <stdio.h>
 
@@ -11,9 +15,36 @@
 #define MAX_SNAKE_LEN    128
 #define INITIAL_SPEED_MS 160
 
+/* "LEN: nnn" box, cleared before each HUD update */
+#define HUD_X0           4
+#define HUD_Y0           4
+#define HUD_X1           (HUD_X0 + 55)
+#define HUD_Y1           (HUD_Y0 + 12)
+
 typedef struct { int x, y; } cell_t;
 typedef enum { DIR_UP, DIR_RIGHT, DIR_DOWN, DIR_LEFT } dir_t;
 
+/******** INPUT MAP ********/
+static const Input_KeyBind_t snake_keys[] = {
+    {'2', INPUT_UP,      0},
+    {'8', INPUT_DOWN,    0},
+    {'4', INPUT_LEFT,    0},
+    {'6', INPUT_RIGHT,   0},
+    {'A', INPUT_RESTART, 0},
+    {'#', INPUT_EXIT,    0}
+};
+
+static const Input_Map_t snake_map = {
+    .keys     = snake_keys,
+    .num_keys = sizeof(snake_keys) / sizeof(snake_keys[0]),
+    .gesture  = {
+        [SWIPE_UP]    = INPUT_UP,
+        [SWIPE_DOWN]  = INPUT_DOWN,
+        [SWIPE_LEFT]  = INPUT_LEFT,
+        [SWIPE_RIGHT] = INPUT_RIGHT
+    }
+};
+
 /******** GAME STATE ********/
 static cell_t snake[MAX_SNAKE_LEN];
 static cell_t fruit;
@@ -23,6 +54,14 @@ static dir_t cur_dir;
 static int grid_w, grid_h;
 static int pixel_w, pixel_h;
 
+/******** RENDER STATE ********/
+// What the panel shows, so a step only repaints the cells that changed
+static int    scene_valid;      // 0 = next draw_scene repaints everything
+static cell_t vacated;          // Tail cell left by the last step
+static int    has_vacated;      // 0 when the snake grew or did not move
+static cell_t drawn_fruit;
+static int    drawn_len;
+
 /******** RNG ********/
 static uint32_t rng_state = 0x12345678;
 static uint32_t rng_next(void)
@@ -77,38 +116,100 @@ static void init_game(void)
 
     cur_dir = DIR_RIGHT;
     place_fruit();
+
+    has_vacated = 0;
+    scene_valid = 0;
 }
 
 /******** DRAW ********/
-static void draw_scene(void)
+static void fill_cell(cell_t c, GUI_COLOR color)
 {
-    GUI_SetBkColor(GUI_BLACK);
-    GUI_Clear();
-
-    GUI_SetColor(GUI_RED);
+    GUI_SetColor(color);
     GUI_FillRect(
-        fruit.x * CELL_SIZE,
-        fruit.y * CELL_SIZE,
-        fruit.x * CELL_SIZE + CELL_SIZE - 1,
-        fruit.y * CELL_SIZE + CELL_SIZE - 1
+        c.x * CELL_SIZE,
+        c.y * CELL_SIZE,
+        c.x * CELL_SIZE + CELL_SIZE - 1,
+        c.y * CELL_SIZE + CELL_SIZE - 1
     );
+}
 
-    GUI_SetColor(GUI_GREEN);
-    for (int i = 0; i < snake_len; i++)
-    {
-        GUI_FillRect(
-            snake[i].x * CELL_SIZE,
-            snake[i].y * CELL_SIZE,
-            snake[i].x * CELL_SIZE + CELL_SIZE - 1,
-            snake[i].y * CELL_SIZE + CELL_SIZE - 1
-        );
-    }
+/* Snake and fruit cells are sprites (sprite_data.c), keyed onto the black board */
+static void draw_sprite_cell(cell_t c, const Sprite_t *spr)
+{
+    Sprite_Draw(spr, c.x * CELL_SIZE, c.y * CELL_SIZE, GUI_BLACK);
+}
 
+static int cell_under_hud(cell_t c)
+{
+    return c.x * CELL_SIZE <= HUD_X1 && c.y * CELL_SIZE <= HUD_Y1;
+}
+
+static void draw_hud(void)
+{
+    char t[32];
+
+    GUI_SetBkColor(GUI_BLACK);
+    GUI_ClearRect(HUD_X0, HUD_Y0, HUD_X1, HUD_Y1);
     GUI_SetColor(GUI_WHITE);
     GUI_SetFont(GUI_FONT_13_ASCII);
-    char t[32];
     sprintf(t, "LEN: %d", snake_len);
-    GUI_DispStringAt(t, 4, 4);
+    GUI_DispStringAt(t, HUD_X0, HUD_Y0);
+    drawn_len = snake_len;
+}
+
+static void draw_full_cb(void *p)
+{
+    (void)p;
+    GUI_SetBkColor(GUI_BLACK);
+    GUI_Clear();
+
+    draw_sprite_cell(fruit, &spr_fruit);
+    for (int i = 0; i < snake_len; i++)
+        draw_sprite_cell(snake[i], &spr_snake_body);
+
+    draw_hud();
+}
+
+/* Whole screen: first frame, restarts and after overlays. Goes through
+   the banded compositor, so the cleared screen is never shown. */
+static void draw_full(void)
+{
+    Compositor_Draw(NULL, draw_full_cb, NULL);
+    drawn_fruit = fruit;
+    scene_valid = 1;
+}
+
+/* One step: new head, old tail, fruit if it moved, HUD if it changed.
+   Constant cost whatever the snake length. */
+static void draw_scene(void)
+{
+    int hud = 0;
+
+    if (!scene_valid)
+    {
+        draw_full();
+        return;
+    }
+
+    if (has_vacated)
+    {
+        fill_cell(vacated, GUI_BLACK);
+        hud |= cell_under_hud(vacated);
+        has_vacated = 0;
+    }
+
+    draw_sprite_cell(snake[0], &spr_snake_body);
+    hud |= cell_under_hud(snake[0]);
+
+    if (fruit.x != drawn_fruit.x || fruit.y != drawn_fruit.y)
+    {
+        draw_sprite_cell(fruit, &spr_fruit);
+        hud |= cell_under_hud(fruit);
+        drawn_fruit = fruit;
+    }
+
+    if (hud || snake_len != drawn_len)
+        draw_hud();
 }
 
 static int is_collision(cell_t h)
@@ -138,9 +239,13 @@ static int move_snake(void)
     if (head.y < 0) head.y = grid_h-1;
     if (head.y >= grid_h) head.y = 0;
 
+    has_vacated = 0;
     if (is_collision(head))
         return -1;
 
+    vacated     = snake[snake_len-1];
+    has_vacated = 1;
+
     for (int i = snake_len-1; i>0; i--)
         snake[i] = snake[i-1];
 
@@ -149,7 +254,11 @@ static int move_snake(void)
     if (head.x == fruit.x && head.y == fruit.y)
     {
         if (snake_len < MAX_SNAKE_LEN)
-            snake[snake_len++] = snake[snake_len-1];
+        {
+            snake[snake_len] = vacated;     // The old tail cell stays body
+            snake_len++;
+            has_vacated = 0;
+        }
 
         place_fruit();
         Sound_FruitBeep();   // << BEEP ON FRUIT
@@ -171,33 +280,40 @@ static void game_over_screen(void)
 void StartSnakeGame(void)
 {
     Sound_Init();   // <<< Initialize buzzer
+    Music_Play(&song_snake);
 
     GUI_Clear();
     init_game();
 
-    uint32_t last = 0;
     uint32_t speed = INITIAL_SPEED_MS;
 
+    Input_Begin(&snake_map);
+
     while (1)
     {
-        char key = Keypad_Get_Key();
-        uint32_t now = osKernelGetTickCount();
+        Input_Action_t act;
+        int turned = 0;
+        int restart = 0;
 
-        if (key && (now - last > 150))
+        /* One turn per step; later turns stay queued for the next steps */
+        Input_Poll();
+        while (!turned && Input_Get(&act))
         {
-            if (key=='2' && cur_dir!=DIR_DOWN) cur_dir=DIR_UP;
-            if (key=='8' && cur_dir!=DIR_UP)   cur_dir=DIR_DOWN;
-            if (key=='4' && cur_dir!=DIR_RIGHT)cur_dir=DIR_LEFT;
-            if (key=='6' && cur_dir!=DIR_LEFT) cur_dir=DIR_RIGHT;
-
-            if (key=='#') return;
-            if (key=='A')
-            {
-                init_game();
-                speed = INITIAL_SPEED_MS;
-            }
+            if (act == INPUT_EXIT) return;
+            if (act == INPUT_RESTART) { restart = 1; break; }
+
+            // Reversals and turns onto the current heading are dropped
+            if (act == INPUT_UP    && cur_dir != DIR_DOWN  && cur_dir != DIR_UP)    { cur_dir = DIR_UP;    turned = 1; }
+            if (act == INPUT_DOWN  && cur_dir != DIR_UP    && cur_dir != DIR_DOWN)  { cur_dir = DIR_DOWN;  turned = 1; }
+            if (act == INPUT_LEFT  && cur_dir != DIR_RIGHT && cur_dir != DIR_LEFT)  { cur_dir = DIR_LEFT;  turned = 1; }
+            if (act == INPUT_RIGHT && cur_dir != DIR_LEFT  && cur_dir != DIR_RIGHT) { cur_dir = DIR_RIGHT; turned = 1; }
+        }
 
-            last = now;
+        if (restart)
+        {
+            init_game();
+            speed = INITIAL_SPEED_MS;
+            Input_Flush();
         }
 
         int result = move_snake();
@@ -206,16 +322,26 @@ void StartSnakeGame(void)
         {
             draw_scene();
             game_over_screen();
+            scene_valid = 0;       // Overlay drawn over the board
             Sound_GameOverBeep();  // <<< LONG BEEP ON GAME OVER
 
-            while (Keypad_Get_Key()!='A')
+            // Wait for a fresh restart or exit
+            Input_Flush();
+            while (1)
             {
-                if (Keypad_Get_Key()=='#') return;
-                osDelay(50);
+                Input_Poll();
+                if (Input_Get(&act))
+                {
+                    if (act == INPUT_EXIT) return;
+                    if (act == INPUT_RESTART) break;
+                    continue;
+                }
+                osDelay(20);
             }
 
             init_game();
             speed = INITIAL_SPEED_MS;
+            Input_Flush();
             continue;
         }
 
@@ -1,54 +1,270 @@
 #include "stm32f4xx.h"
+#include "stm32f4xx_hal.h"
 #include "sound.h"
+#include "audio_i2s.h"
+#include "mixer.h"
+#include "music.h"
 #include <stdint.h>
+#include <stddef.h>
 
 #include "cmsis_os2.h"
 
-/* Buzzer pin = PB4 */
-#define BUZ_PIN     (1 << 4)
+/* Buzzer pin = PB4, driven by TIM3_CH1 (AF2) in PWM mode 1 */
+#define BUZ_PIN_NUM     4U
+#define BUZ_AF          2U
+#define BUZ_TIMER_HZ    1000000U    // Counter clock after the prescaler
+#define SOUND_TICK_MS   5U          // Sequencer resolution
+#define SOUND_QUEUE_LEN 8U
+#define SOUND_STK_SZ    (512U)
+#define SOUND_PCM_RATE  16000U      // Mixer output rate through the codec
 
-void delay_ms(uint32_t ms)
+/*
+ * The sequencer runs from a periodic osTimer: the callback counts down the
+ * current note and reprograms TIM3 for the next one. Sound_Play only hands
+ * over one pointer, so callers never wait for a note to finish.
+ */
+static osTimerId_t              snd_timer;
+static const Sound_Seq_t *volatile snd_req;    // Next sequence, picked up by the callback
+static const Sound_Seq_t       *snd_seq;       // Timer thread only from here down
+static uint8_t                  snd_pos;
+static uint32_t                 snd_left;      // ms left of the current note
+
+static osMessageQueueId_t       sfx_queue;
+static osThreadId_t             sfx_tid;
+
+static uint64_t sound_stk[SOUND_STK_SZ / 8];
+static const osThreadAttr_t sound_attr = {
+    .name       = "sound",
+    .stack_mem  = &sound_stk[0],
+    .stack_size = sizeof(sound_stk),
+    .priority   = osPriorityAboveNormal
+};
+
+static void Sound_Thread(void *argument);
+
+/* PWM at freq_hz with 50% duty, 0 = silent (output held low) */
+static void Sound_Tone(uint16_t freq_hz)
 {
-    for (uint32_t i = 0; i < ms * 16000; i++) __NOP();
+    if (freq_hz == 0U) {
+        TIM3->CCR1 = 0;
+        return;
+    }
+    uint32_t period = BUZ_TIMER_HZ / freq_hz;
+    if (period > 0x10000U) period = 0x10000U;
+    if (period < 2U)       period = 2U;
+
+    TIM3->ARR  = period - 1U;
+    TIM3->CCR1 = period / 2U;
+    TIM3->EGR  = TIM_EGR_UG;        // Load the new period now, not at the old overflow
+}
+
+static void Sound_TimerCb(void *arg)
+{
+    const Sound_Seq_t *req = snd_req;
+
+    (void)arg;
+    if (req != NULL) {
+        // A new request replaces whatever is playing
+        snd_req  = NULL;
+        snd_seq  = req;
+        snd_pos  = 0;
+        snd_left = 0;
+    }
+    if (snd_seq == NULL) return;
+
+    if (snd_left > SOUND_TICK_MS) {
+        snd_left -= SOUND_TICK_MS;
+        return;
+    }
+    if (req == NULL) snd_pos++;
+
+    if (snd_pos >= snd_seq->len) {
+        Sound_Tone(0);
+        snd_seq = NULL;
+        osTimerStop(snd_timer);
+        return;
+    }
+    Sound_Tone(snd_seq->notes[snd_pos].freq_hz);
+    snd_left = snd_seq->notes[snd_pos].ms;
 }
 
 void Sound_Init(void)
 {
-    /* Enable GPIOB clock */
-    RCC->AHB1ENR |= (1 << 1);
+    /* Enable GPIOB and TIM3 clocks */
+    RCC->AHB1ENR |= RCC_AHB1ENR_GPIOBEN;
+    RCC->APB1ENR |= RCC_APB1ENR_TIM3EN;
+    (void)RCC->APB1ENR;
 
-    /* Set PB4 as GENERAL PURPOSE OUTPUT (01) */
-    GPIOB->MODER &= ~(3 << (4 * 2));
-    GPIOB->MODER |=  (1 << (4 * 2));
+    /* PB4 as alternate function AF2 (TIM3_CH1), push-pull, no pull-up/down */
+    GPIOB->MODER  &= ~(3U << (BUZ_PIN_NUM * 2U));
+    GPIOB->MODER  |=  (2U << (BUZ_PIN_NUM * 2U));
+    GPIOB->OTYPER &= ~(1U << BUZ_PIN_NUM);
+    GPIOB->PUPDR  &= ~(3U << (BUZ_PIN_NUM * 2U));
+    GPIOB->AFR[0] &= ~(0xFU << (BUZ_PIN_NUM * 4U));
+    GPIOB->AFR[0] |=  (BUZ_AF << (BUZ_PIN_NUM * 4U));
 
-    /* Push-pull, no pull-up/down */
-    GPIOB->OTYPER &= ~BUZ_PIN;
-    GPIOB->PUPDR   &= ~(3 << (4 * 2));
+    /* TIM3 on APB1: timer clock is 2 x PCLK1 (prescaled APB1) */
+    TIM3->CR1   = 0;
+    TIM3->PSC   = (2U * HAL_RCC_GetPCLK1Freq()) / BUZ_TIMER_HZ - 1U;
+    TIM3->CCMR1 = (TIM3->CCMR1 & ~(TIM_CCMR1_OC1M | TIM_CCMR1_CC1S)) |
+                  TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1 | TIM_CCMR1_OC1PE;  // PWM mode 1
+    TIM3->CCER |= TIM_CCER_CC1E;
 
     /* Start with buzzer OFF */
-    GPIOB->BSRR = (BUZ_PIN << 16);   // reset PB4
+    Sound_Tone(0);
+    TIM3->CR1   = TIM_CR1_ARPE | TIM_CR1_CEN;
+
+    if (snd_timer == NULL) snd_timer = osTimerNew(Sound_TimerCb, osTimerPeriodic, NULL, NULL);
+    if (sfx_queue == NULL) sfx_queue = osMessageQueueNew(SOUND_QUEUE_LEN, sizeof(uint8_t), NULL);
+    if (sfx_tid   == NULL) sfx_tid   = osThreadNew(Sound_Thread, NULL, &sound_attr);
+}
+
+/* Start a note list, cutting off the one playing; returns at once */
+void Sound_Play(const Sound_Seq_t *seq)
+{
+    if (snd_timer == NULL) Sound_Init();
+
+    snd_req = seq;
+    osTimerStart(snd_timer, SOUND_TICK_MS);
+}
+
+void Sound_Stop(void)
+{
+    static const Sound_Seq_t silence = { NULL, 0 };
+
+    Sound_Play(&silence);
+}
+
+int Sound_IsPlaying(void)
+{
+    return (snd_req != NULL) || (snd_seq != NULL);
+}
+
+/* Background music on the buzzer: only sounds while no effect sequence does */
+void Sound_MusicTone(uint16_t freq_hz)
+{
+    if (!Sound_IsPlaying()) Sound_Tone(freq_hz);
 }
 
-static void beep_ms(uint32_t time_ms)
+/* =========================================================================
+   SOUND EFFECT SERVICE
+   ========================================================================= */
+static const Sound_Note_t fruit_notes[] = {
+    {2000, 45}      // small chirp
+};
+
+static const Sound_Note_t game_over_notes[] = {
+    {1000, 200}, {0, 50},
+    {1000, 200}, {0, 50},
+    {1000, 200}
+};
+
+typedef struct {
+    const Mixer_Clip_t *clip;   // PCM effect (codec path)
+    Sound_Seq_t seq;            // Buzzer fallback
+    uint16_t    vol;            // Q15
+    uint8_t     prio;           // Higher cuts off lower, lower never cuts off higher
+    uint16_t    coalesce_ms;    // Repeats of the same effect inside this window are dropped
+} Sound_Sfx_t;
+
+static const Sound_Sfx_t sfx_table[SFX_COUNT] = {
+    [SFX_FRUIT]     = { &sfx_clip_fruit,     { fruit_notes,     1 }, 20000, 1, 30   },
+    [SFX_GAME_OVER] = { &sfx_clip_game_over, { game_over_notes, 5 }, 26000, 2, 1000 }
+};
+
+static uint8_t sfx_pcm;                 // Codec path is up: effects go to the mixer
+static int8_t  sfx_voice[SFX_COUNT];    // Mixer voice of each effect's latest start
+static uint8_t sfx_tone = SFX_NONE;     // Effect on the buzzer
+
+/* Audio_Render_t: effects first, the music channels are added on top */
+static void Sound_Render(int16_t *buf, uint32_t frames)
+{
+    Mixer_Render(buf, frames);
+    Music_Render(buf, frames);
+}
+
+int Sound_PcmReady(void)
+{
+    return sfx_pcm;
+}
+
+static int Sound_SfxBusy(uint8_t id)
+{
+    if (sfx_pcm) return Mixer_IsPlaying(sfx_voice[id], sfx_table[id].clip);
+    return (sfx_tone == id) && Sound_IsPlaying();
+}
+
+/*
+ * Decides what plays: a request is dropped if a higher priority effect is
+ * still sounding, or if the same effect started less than its coalescing
+ * window ago. On the codec, effects of equal priority overlap on separate
+ * mixer voices and lower ones are cut off; the buzzer plays one at a time.
+ */
+static __NO_RETURN void Sound_Thread(void *argument)
 {
-    GPIOB->BSRR = BUZ_PIN;         // PB4 HIGH = 3.3V ? buzzer ON
-    delay_ms(time_ms);
-    GPIOB->BSRR = (BUZ_PIN << 16); // PB4 LOW  ? buzzer OFF
+    uint32_t last_tick[SFX_COUNT];
+    uint32_t started = 0;               // Bit per effect: last_tick is valid
+
+    (void)argument;
+
+    // PLL lock and codec set-up happen here, off the game threads. Either
+    // failing leaves effects and music on the buzzer.
+    if (Audio_Init(SOUND_PCM_RATE) == 0) {
+        Mixer_Init(Audio_GetSampleRate());
+        Music_Init(Audio_GetSampleRate());
+        Audio_Start(Sound_Render);      // Mixer and music are ready: render from now on
+        sfx_pcm = 1;
+        Sound_MusicTone(0);             // Music moves off the buzzer
+    }
+
+    while (1) {
+        uint8_t id;
+        int     drop = 0;
+
+        if (osMessageQueueGet(sfx_queue, &id, NULL, osWaitForever) != osOK) continue;
+        if ((id == SFX_NONE) || (id >= SFX_COUNT)) continue;
+
+        uint32_t now = osKernelGetTickCount();
+
+        for (uint8_t e = SFX_NONE + 1; e < SFX_COUNT; e++) {
+            if (Sound_SfxBusy(e) && (sfx_table[e].prio > sfx_table[id].prio)) drop = 1;
+        }
+        if ((started & (1U << id)) && ((now - last_tick[id]) < sfx_table[id].coalesce_ms)) drop = 1;
+        if (drop) continue;
+
+        last_tick[id] = now;
+        started      |= (1U << id);
+
+        if (sfx_pcm) {
+            for (uint8_t e = SFX_NONE + 1; e < SFX_COUNT; e++) {
+                if ((sfx_table[e].prio < sfx_table[id].prio) && Sound_SfxBusy(e)) Mixer_Stop(sfx_voice[e]);
+            }
+            sfx_voice[id] = (int8_t)Mixer_Play(sfx_table[id].clip, sfx_table[id].vol, MIXER_PAN_CENTER);
+        } else {
+            sfx_tone = id;
+            Sound_Play(&sfx_table[id].seq);
+        }
+    }
+}
+
+/* Costs one queue put (never waits); a full queue drops the request */
+void Sound_Post(Sound_Effect_t id)
+{
+    uint8_t msg = (uint8_t)id;
+
+    if (id >= SFX_COUNT) return;
+    if (sfx_queue == NULL) Sound_Init();
+    osMessageQueuePut(sfx_queue, &msg, sfx_table[id].prio, 0);
 }
 
 /********** SHORT BEEP FOR FRUIT **********/
 void Sound_FruitBeep(void)
 {
-    beep_ms(45);   // small chirp
+    Sound_Post(SFX_FRUIT);
 }
 
 /********** LONG BEEP FOR GAME OVER **********/
 void Sound_GameOverBeep(void)
 {
-    beep_ms(200);
-    osDelay(50);
-    beep_ms(200);	
-	  osDelay(50);
-	  beep_ms(200);
-	
+    Sound_Post(SFX_GAME_OVER);
 }
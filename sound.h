@@ -1,7 +1,33 @@
 #ifndef SOUND_H
 #define SOUND_H
 
+#include <stdint.h>
+
+typedef struct {
+    uint16_t freq_hz;       // 0 = rest
+    uint16_t ms;
+} Sound_Note_t;
+
+typedef struct {
+    const Sound_Note_t *notes;
+    uint8_t             len;
+} Sound_Seq_t;
+
+// Effects served by the sound thread (see sfx_table in sound.c)
+typedef enum {
+    SFX_NONE = 0,
+    SFX_FRUIT,
+    SFX_GAME_OVER,
+    SFX_COUNT
+} Sound_Effect_t;
+
 void Sound_Init(void);
+void Sound_Post(Sound_Effect_t id);
+void Sound_Play(const Sound_Seq_t *seq);
+void Sound_Stop(void);
+int  Sound_IsPlaying(void);
+int  Sound_PcmReady(void);
+void Sound_MusicTone(uint16_t freq_hz);
 void Sound_FruitBeep(void);
 void Sound_GameOverBeep(void);
 
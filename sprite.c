@@ -0,0 +1,179 @@
+#ifdef _RTE_
+#include "RTE_Components.h"
+#endif
+#include "sprite.h"
+#include "LCD.h"
+#include "compositor.h"
+#include <stddef.h>
+
+/*
+ * Pre-converted images from flash. On the 16-bit FSMC panel a sprite is
+ * one GRAM window and one burst: raw images stream straight from flash
+ * through the DMA pump, RLE runs go out as constant fills. No colour
+ * conversion or per-primitive window set-up happens at draw time.
+ *
+ * The direct path assumes emWin draws unrotated (DISPLAY_ORIENTATION 0
+ * in LCDConf), so emWin coordinates are GRAM coordinates. Inside the
+ * compositor's bands, on the SPI panel, and for see-through keyed pixels
+ * the same spans go through emWin instead.
+ */
+#ifdef RTE_Graphics_LCD_MCBQVGA_LG_16
+#include "lcd_dma.h"
+#define SPRITE_DIRECT   1
+#else
+#define SPRITE_DIRECT   0
+#endif
+
+/* One horizontal piece of a run, in sprite coordinates. Returns 0 to stop. */
+typedef int span_fn_t(void *ctx, int col, int row, int len, uint16_t index);
+
+typedef struct {
+    int      x, y;          // Sprite origin on screen
+    GUI_RECT r;             // Visible part, sprite coordinates
+    uint16_t key;
+    uint16_t bk;            // Replaces keyed pixels
+    int      keyed;         // Keyed pixels to handle: 0, 1 = replace, 2 = skip
+} blit_t;
+
+/* Walk the image as runs of one index in raster order, split at row ends */
+static void for_each_span(const Sprite_t *spr, span_fn_t *fn, void *ctx)
+{
+    const uint16_t *d = spr->data;
+    uint32_t i = 0;
+    uint32_t p = 0;         // Pixel position of the run
+
+    while (i < spr->words) {
+        uint32_t n;
+        uint16_t index;
+
+        if (spr->flags & SPRITE_RLE) {
+            n     = d[i];
+            index = d[i + 1];
+            i    += 2;
+        } else {
+            index = d[i];
+            n     = 1;
+            while ((++i < spr->words) && (d[i] == index)) n++;
+        }
+
+        while (n > 0U) {
+            int col = (int)(p % spr->w);
+            int row = (int)(p / spr->w);
+            int len = spr->w - col;
+
+            if ((uint32_t)len > n) len = (int)n;
+            if (!fn(ctx, col, row, len, index)) return;
+            p += (uint32_t)len;
+            n -= (uint32_t)len;
+        }
+    }
+}
+
+/* emWin: clipping and memory devices are its business */
+static int span_emwin(void *ctx, int col, int row, int len, uint16_t index)
+{
+    blit_t *b = ctx;
+
+    if (b->keyed && (index == b->key)) {
+        if (b->keyed == 2) return 1;
+        index = b->bk;
+    }
+    GUI_SetColorIndex(index);
+    GUI_DrawHLine(b->y + row, b->x + col, b->x + col + len - 1);
+    return 1;
+}
+
+#if SPRITE_DIRECT
+/* GRAM: the window is the visible part, so spans arrive in its fill order */
+static int span_direct(void *ctx, int col, int row, int len, uint16_t index)
+{
+    blit_t *b = ctx;
+    int c0 = col, c1 = col + len - 1;
+
+    if (row < b->r.y0) return 1;
+    if (row > b->r.y1) return 0;
+    if (c0 < b->r.x0) c0 = b->r.x0;
+    if (c1 > b->r.x1) c1 = b->r.x1;
+    if (c0 > c1) return 1;
+
+    if (b->keyed && (index == b->key)) index = b->bk;
+    LCD_DMA_Fill(index, (uint32_t)(c1 - c0 + 1));
+    return 1;
+}
+
+static void blit_direct(const Sprite_t *spr, blit_t *b)
+{
+    int w = b->r.x1 - b->r.x0 + 1;
+
+    LCD_X_SetWindow((uint16_t)(b->x + b->r.x0), (uint16_t)(b->y + b->r.y0),
+                    (uint16_t)(b->x + b->r.x1), (uint16_t)(b->y + b->r.y1));
+
+    if ((spr->flags & SPRITE_RLE) || b->keyed) {
+        for_each_span(spr, span_direct, b);
+        return;
+    }
+
+    // Raw and opaque: whole rows are one run in flash
+    const uint16_t *src = spr->data + b->r.y0 * spr->w + b->r.x0;
+    if (w == spr->w) {
+        LCD_DMA_Stream(src, (uint32_t)(w * (b->r.y1 - b->r.y0 + 1)));
+        return;
+    }
+    for (int row = b->r.y0; row <= b->r.y1; row++, src += spr->w)
+        LCD_DMA_Stream(src, (uint32_t)w);
+}
+#endif
+
+/*
+ * Draw `spr` with its top left corner at (x, y), clipped to the screen and
+ * to `clip` (NULL = screen only). Keyed pixels are drawn in `bk`, which
+ * keeps the single burst, or left alone with SPRITE_TRANSPARENT.
+ */
+void Sprite_DrawClip(const Sprite_t *spr, int x, int y, GUI_COLOR bk, const GUI_RECT *clip)
+{
+    blit_t b;
+
+    if ((spr == NULL) || (spr->w == 0U) || (spr->h == 0U)) return;
+
+    b.x    = x;
+    b.y    = y;
+    b.r.x0 = 0;
+    b.r.y0 = 0;
+    b.r.x1 = spr->w - 1;
+    b.r.y1 = spr->h - 1;
+    if (x + b.r.x0 < 0) b.r.x0 = -x;
+    if (y + b.r.y0 < 0) b.r.y0 = -y;
+    if (x + b.r.x1 >= LCD_GetXSize()) b.r.x1 = LCD_GetXSize() - 1 - x;
+    if (y + b.r.y1 >= LCD_GetYSize()) b.r.y1 = LCD_GetYSize() - 1 - y;
+    if (clip != NULL) {
+        if (x + b.r.x0 < clip->x0) b.r.x0 = clip->x0 - x;
+        if (y + b.r.y0 < clip->y0) b.r.y0 = clip->y0 - y;
+        if (x + b.r.x1 > clip->x1) b.r.x1 = clip->x1 - x;
+        if (y + b.r.y1 > clip->y1) b.r.y1 = clip->y1 - y;
+    }
+    if ((b.r.x0 > b.r.x1) || (b.r.y0 > b.r.y1)) return;
+
+    b.key   = spr->key;
+    b.keyed = 0;
+    b.bk    = 0;
+    if (spr->flags & SPRITE_KEYED) {
+        b.keyed = (bk == SPRITE_TRANSPARENT) ? 2 : 1;
+        if (b.keyed == 1) b.bk = (uint16_t)LCD_Color2Index(bk);
+    }
+
+#if SPRITE_DIRECT
+    if (!Compositor_Active() && (b.keyed != 2)) {
+        blit_direct(spr, &b);
+        return;
+    }
+#endif
+
+    if (clip != NULL) GUI_SetClipRect(clip);
+    for_each_span(spr, span_emwin, &b);
+    if (clip != NULL) GUI_SetClipRect(NULL);
+}
+
+void Sprite_Draw(const Sprite_t *spr, int x, int y, GUI_COLOR bk)
+{
+    Sprite_DrawClip(spr, x, y, bk, NULL);
+}
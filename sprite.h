@@ -0,0 +1,35 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <stdint.h>
+#include "GUI.h"
+
+// Pixels are GUICC_565 colour indices (blue in the top bits, as the panel
+// takes them), converted offline by tools/sprites.py
+#define SPRITE_RLE          0x01    // data = (count, index) pairs in raster order
+#define SPRITE_KEYED        0x02    // Pixels equal to `key` are see-through
+
+// bk argument: keyed pixels keep what is on screen (slower, through emWin)
+#define SPRITE_TRANSPARENT  0xFFFFFFFFUL
+
+typedef struct {
+    uint16_t        w, h;
+    uint8_t         flags;
+    uint16_t        key;            // Transparent index when SPRITE_KEYED
+    const uint16_t *data;           // w * h indices, or RLE pairs
+    uint32_t        words;          // Length of data
+} Sprite_t;
+
+void Sprite_Draw(const Sprite_t *spr, int x, int y, GUI_COLOR bk);
+void Sprite_DrawClip(const Sprite_t *spr, int x, int y, GUI_COLOR bk, const GUI_RECT *clip);
+
+// Images (sprite_data.c, generated by tools/sprites.py)
+extern const Sprite_t spr_bird;
+extern const Sprite_t spr_bird_cw;
+extern const Sprite_t spr_snake_body;
+extern const Sprite_t spr_fruit;
+extern const Sprite_t spr_brick_green;
+extern const Sprite_t spr_brick_yellow;
+extern const Sprite_t spr_ball;
+
+#endif
@@ -0,0 +1,99 @@
+/* Generated by tools/sprites.py, do not edit */
+#include "sprite.h"
+
+static const uint16_t spr_bird_data[121] = {
+    0xF81F, 0xF81F, 0xF81F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF81F, 0xF81F, 0xF81F, 0xF81F,
+    0xF81F, 0x0000, 0x07FF, 0x07FF, 0x07FF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xF81F, 0xF81F, 0x0000,
+    0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xF81F, 0x0000, 0x07FF,
+    0x07FF, 0x07FF, 0x07FF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x07FF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x07FF, 0x041F, 0x041F, 0x041F, 0x041F, 0x0000, 0x07FF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000,
+    0x041F, 0x0000, 0x0000, 0x0000, 0x0000, 0xF81F, 0x0000, 0x07FF, 0x07FF, 0x07FF, 0x0000, 0x041F,
+    0x041F, 0x041F, 0x0000, 0xF81F, 0xF81F, 0x0000, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0000, 0x0000,
+    0x0000, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0x0000, 0x0000, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0000,
+    0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0x0000, 0x0000, 0x0000, 0x0000, 0xF81F, 0xF81F,
+    0xF81F,
+};
+
+const Sprite_t spr_bird = { 11, 11, SPRITE_KEYED, 0xF81F, spr_bird_data, 121 };
+
+static const uint16_t spr_snake_body_data[144] = {
+    0xF81F, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0xF81F,
+    0x0400, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x0400,
+    0x0400, 0x07E0, 0x87F0, 0x87F0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x0400,
+    0x0400, 0x07E0, 0x87F0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x0400,
+    0x0400, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x0400,
+    0x0400, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x0400,
+    0x0400, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x0400,
+    0x0400, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x0400,
+    0x0400, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x0400,
+    0x0400, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x0400, 0x0400,
+    0x0400, 0x0400, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x0400, 0x0400, 0x0400,
+    0xF81F, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0xF81F,
+};
+
+const Sprite_t spr_snake_body = { 12, 12, SPRITE_KEYED, 0xF81F, spr_snake_body_data, 144 };
+
+static const uint16_t spr_fruit_data[144] = {
+    0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0x2954, 0x07E0, 0x07E0, 0xF81F, 0xF81F, 0xF81F,
+    0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0x2954, 0x07E0, 0x07E0, 0xF81F, 0xF81F, 0xF81F, 0xF81F,
+    0xF81F, 0xF81F, 0x001F, 0x001F, 0x001F, 0x2954, 0x001F, 0x001F, 0x001F, 0xF81F, 0xF81F, 0xF81F,
+    0xF81F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0xF81F, 0xF81F,
+    0x001F, 0xC61F, 0xC61F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0xF81F,
+    0x001F, 0xC61F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0xF81F,
+    0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0xF81F,
+    0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x0012, 0x0012, 0xF81F,
+    0xF81F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x0012, 0x0012, 0xF81F, 0xF81F,
+    0xF81F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x0012, 0x0012, 0x0012, 0xF81F, 0xF81F,
+    0xF81F, 0xF81F, 0x0012, 0x001F, 0x001F, 0x001F, 0x0012, 0x0012, 0x0012, 0xF81F, 0xF81F, 0xF81F,
+    0xF81F, 0xF81F, 0xF81F, 0x0012, 0x0012, 0xF81F, 0x0012, 0x0012, 0xF81F, 0xF81F, 0xF81F, 0xF81F,
+};
+
+const Sprite_t spr_fruit = { 12, 12, SPRITE_KEYED, 0xF81F, spr_fruit_data, 144 };
+
+static const uint16_t spr_ball_data[49] = {
+    0xF81F, 0xF81F, 0x001F, 0x001F, 0x001F, 0xF81F, 0xF81F, 0xF81F, 0x001F, 0xC61F, 0x001F, 0x001F,
+    0x001F, 0xF81F, 0x001F, 0xC61F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F,
+    0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x0012, 0x001F, 0xF81F,
+    0x001F, 0x001F, 0x001F, 0x0012, 0x0012, 0xF81F, 0xF81F, 0xF81F, 0x0012, 0x0012, 0x0012, 0xF81F,
+    0xF81F,
+};
+
+const Sprite_t spr_ball = { 7, 7, SPRITE_KEYED, 0xF81F, spr_ball_data, 49 };
+
+static const uint16_t spr_brick_green_data[58] = {
+    0x001D, 0x87F0, 0x001A, 0x07E0, 0x0001, 0x0400, 0x0001, 0x87F0, 0x001A, 0x07E0, 0x0001, 0x0400,
+    0x0001, 0x87F0, 0x001A, 0x07E0, 0x0001, 0x0400, 0x0001, 0x87F0, 0x001A, 0x07E0, 0x0001, 0x0400,
+    0x0001, 0x87F0, 0x001A, 0x07E0, 0x0001, 0x0400, 0x0001, 0x87F0, 0x001A, 0x07E0, 0x0001, 0x0400,
+    0x0001, 0x87F0, 0x001A, 0x07E0, 0x0001, 0x0400, 0x0001, 0x87F0, 0x001A, 0x07E0, 0x0001, 0x0400,
+    0x0001, 0x87F0, 0x001A, 0x07E0, 0x0001, 0x0400, 0x0001, 0x87F0, 0x001B, 0x0400,
+};
+
+const Sprite_t spr_brick_green = { 28, 11, SPRITE_RLE, 0x0000, spr_brick_green_data, 58 };
+
+static const uint16_t spr_brick_yellow_data[58] = {
+    0x001D, 0x87FF, 0x001A, 0x07FF, 0x0001, 0x0514, 0x0001, 0x87FF, 0x001A, 0x07FF, 0x0001, 0x0514,
+    0x0001, 0x87FF, 0x001A, 0x07FF, 0x0001, 0x0514, 0x0001, 0x87FF, 0x001A, 0x07FF, 0x0001, 0x0514,
+    0x0001, 0x87FF, 0x001A, 0x07FF, 0x0001, 0x0514, 0x0001, 0x87FF, 0x001A, 0x07FF, 0x0001, 0x0514,
+    0x0001, 0x87FF, 0x001A, 0x07FF, 0x0001, 0x0514, 0x0001, 0x87FF, 0x001A, 0x07FF, 0x0001, 0x0514,
+    0x0001, 0x87FF, 0x001A, 0x07FF, 0x0001, 0x0514, 0x0001, 0x87FF, 0x001B, 0x0514,
+};
+
+const Sprite_t spr_brick_yellow = { 28, 11, SPRITE_RLE, 0x0000, spr_brick_yellow_data, 58 };
+
+static const uint16_t spr_bird_cw_data[121] = {
+    0xF81F, 0xF81F, 0xF81F, 0xF81F, 0x0000, 0x0000, 0x0000, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF81F,
+    0xF81F, 0x0000, 0x0000, 0x07FF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xF81F, 0xF81F, 0xF81F, 0x0000,
+    0x07FF, 0x07FF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07FF, 0x07FF, 0x0000, 0xF81F, 0xF81F, 0x0000, 0x07FF,
+    0x07FF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07FF, 0x07FF, 0x07FF, 0x0000, 0x0000, 0x07FF, 0x07FF, 0x07FF,
+    0xFFFF, 0xFFFF, 0x0000, 0x07FF, 0x07FF, 0x07FF, 0x0000, 0x0000, 0x07FF, 0x07FF, 0x0000, 0x0000,
+    0x0000, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0000, 0x0000, 0x07FF, 0x0000, 0x041F, 0x041F, 0x07FF,
+    0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x041F, 0x0000, 0x041F, 0x0000,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xF81F, 0x0000, 0x0000, 0x041F, 0x0000, 0x041F, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0x0000, 0x0000, 0x041F, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0x0000, 0x041F, 0x0000, 0x0000, 0x0000, 0xF81F,
+    0xF81F,
+};
+
+const Sprite_t spr_bird_cw = { 11, 11, SPRITE_KEYED, 0xF81F, spr_bird_cw_data, 121 };
+
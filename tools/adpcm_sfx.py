@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Build the mixer's sound-effect clips as 4-bit IMA-ADPCM C arrays.
+
+Each effect is either synthesised from a note list (see EFFECTS below) or
+read from a mono 16-bit WAV file. The encoder starts at predictor 0 and
+step index 0 and packs the low nibble first, matching Mixer_Decode.
+
+    python3 tools/adpcm_sfx.py > sfx_clips.c
+    python3 tools/adpcm_sfx.py --wav name=file.wav ... > sfx_clips.c
+"""
+import math
+import struct
+import sys
+import wave
+
+RATE = 8000
+
+IMA_STEP = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37,
+    41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173,
+    190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484,
+    7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500,
+    20350, 22385, 24623, 27086, 29794, 32767]
+IMA_INDEX = [-1, -1, -1, -1, 2, 4, 6, 8] * 2
+
+# name -> list of (start Hz, end Hz, ms, amplitude 0..1); 0 Hz is a rest
+EFFECTS = {
+    "fruit": [(1800, 2600, 60, 0.6)],
+    "game_over": [(660, 620, 200, 0.7), (0, 0, 50, 0),
+                  (550, 510, 200, 0.7), (0, 0, 50, 0),
+                  (440, 380, 300, 0.7)],
+}
+
+
+def synth(notes, rate=RATE):
+    out, phase = [], 0.0
+    for f0, f1, ms, amp in notes:
+        n = rate * ms // 1000
+        for i in range(n):
+            t = i / max(n - 1, 1)
+            env = min(1.0, i / (rate * 0.004)) * (1.0 - t) ** 0.5   # 4 ms attack, decay
+            phase += 2 * math.pi * (f0 + (f1 - f0) * t) / rate
+            out.append(int(32767 * amp * env * math.sin(phase)) if f0 else 0)
+    return out
+
+
+def read_wav(path):
+    with wave.open(path, "rb") as w:
+        if w.getnchannels() != 1 or w.getsampwidth() != 2:
+            sys.exit("%s: need mono 16-bit PCM" % path)
+        raw = w.readframes(w.getnframes())
+        return list(struct.unpack("<%dh" % (len(raw) // 2), raw)), w.getframerate()
+
+
+def encode(samples):
+    pred, index, nibbles = 0, 0, []
+    for s in samples:
+        step = IMA_STEP[index]
+        diff = s - pred
+        n = 8 if diff < 0 else 0
+        diff = abs(diff)
+        if diff >= step:
+            n |= 4
+            diff -= step
+        if diff >= step >> 1:
+            n |= 2
+            diff -= step >> 1
+        if diff >= step >> 2:
+            n |= 1
+        # Track the decoder exactly so errors don't accumulate
+        d = step >> 3
+        if n & 4: d += step
+        if n & 2: d += step >> 1
+        if n & 1: d += step >> 2
+        pred = max(-32768, min(32767, pred - d if n & 8 else pred + d))
+        index = max(0, min(88, index + IMA_INDEX[n]))
+        nibbles.append(n)
+    if len(nibbles) & 1:
+        nibbles.append(0)
+    return bytes(nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, len(nibbles), 2))
+
+
+def emit(name, samples, rate):
+    data = encode(samples)
+    print("static const uint8_t sfx_%s_data[%d] = {" % (name, len(data)))
+    for i in range(0, len(data), 16):
+        print("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    print("};\n")
+    print("const Mixer_Clip_t sfx_clip_%s = { sfx_%s_data, %d, %d };\n" % (name, name, len(samples), rate))
+
+
+def main(argv):
+    clips = {name: (synth(notes), RATE) for name, notes in EFFECTS.items()}
+    for arg in argv:
+        if arg.startswith("--wav") or "=" not in arg:
+            continue
+        name, path = arg.split("=", 1)
+        clips[name] = read_wav(path)
+
+    print("/* Generated by tools/adpcm_sfx.py, do not edit */")
+    print('#include "mixer.h"\n')
+    for name, (samples, rate) in clips.items():
+        emit(name, samples, rate)
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
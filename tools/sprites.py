@@ -0,0 +1,224 @@
+#!/usr/bin/env python3
+"""Build the games' sprites as const RGB565 C arrays for sprite.c.
+
+Each image is pixel art from SPRITES below or a binary PPM (P6) file.
+Colours are written the emWin way, 0xBBGGRR, and converted to GUICC_565
+indices (blue in the top bits), the word the panel takes as is. '.' in the
+art, or magenta in a PPM, is see-through: the sprite gets SPRITE_KEYED.
+
+Options per image: "rle" stores (count, index) pairs instead of raw
+pixels (worth it for flat images), "cw" rotates it a quarter turn
+clockwise (for the landscape Flappy, which draws across the panel).
+
+    python3 tools/sprites.py > sprite_data.c
+    python3 tools/sprites.py name=file.ppm[,rle][,cw] ... > sprite_data.c
+"""
+import sys
+
+# Colours, 0xBBGGRR as in GUI.h
+BLACK = 0x000000
+WHITE = 0xFFFFFF
+YELLOW = 0x00FFFF
+ORANGE = 0x0080FF
+GREEN = 0x00FF00
+DARK_GREEN = 0x008000
+LIGHT_GREEN = 0x80FF80
+RED = 0x0000FF
+DARK_RED = 0x000090
+BROWN = 0x2A2AA5
+PINK = 0xC0C0FF
+MAGENTA = 0xFF00FF      # See-through in PPM files
+
+# name -> (art rows, palette, options); '.' is see-through
+SPRITES = {
+    # 11 x 11: the classic bird box, BIRD_SIZE inclusive
+    "bird": ([
+        "...KKKKK...",
+        "..KYYYKWWK.",
+        ".KYYYYKWKWK",
+        ".KYYYYKWWWK",
+        "KWWWKYYKKKK",
+        "KWWWWKYOOOO",
+        "KYWWWKOKKKK",
+        ".KYYYKOOOK.",
+        ".KYYYYKKK..",
+        "..KKYYYYK..",
+        "....KKKK...",
+    ], {"K": BLACK, "Y": YELLOW, "W": WHITE, "O": ORANGE}, ()),
+
+    # 12 x 12: CELL_SIZE
+    "snake_body": ([
+        ".DDDDDDDDDD.",
+        "DGGGGGGGGGGD",
+        "DGLLGGGGGGGD",
+        "DGLGGGGGGGGD",
+        "DGGGGGGGGGGD",
+        "DGGGGGGGGGGD",
+        "DGGGGGGGGGGD",
+        "DGGGGGGGGGGD",
+        "DGGGGGGGGGGD",
+        "DGGGGGGGGGDD",
+        "DDGGGGGGGDDD",
+        ".DDDDDDDDDD.",
+    ], {"D": DARK_GREEN, "G": GREEN, "L": LIGHT_GREEN}, ()),
+
+    "fruit": ([
+        "......SFF...",
+        ".....SFF....",
+        "..RRRSRRR...",
+        ".RRRRRRRRR..",
+        "RPPRRRRRRRR.",
+        "RPRRRRRRRRR.",
+        "RRRRRRRRRRR.",
+        "RRRRRRRRRrr.",
+        ".RRRRRRRrr..",
+        ".RRRRRRrrr..",
+        "..rRRRrrr...",
+        "...rr.rr....",
+    ], {"R": RED, "r": DARK_RED, "P": PINK, "S": BROWN, "F": GREEN}, ()),
+
+    # 7 x 7: BALL_SIZE inclusive
+    "ball": ([
+        "..RRR..",
+        ".RPRRR.",
+        "RPRRRRR",
+        "RRRRRRR",
+        "RRRRRrR",
+        ".RRRrr.",
+        "..rrr..",
+    ], {"R": RED, "r": DARK_RED, "P": PINK}, ()),
+}
+
+
+def bevel(w, h, face, light, dark):
+    """Flat block with a light top/left and dark bottom/right edge."""
+    rows = []
+    for y in range(h):
+        row = []
+        for x in range(w):
+            if y == 0 or x == 0:
+                row.append(light)
+            elif y == h - 1 or x == w - 1:
+                row.append(dark)
+            else:
+                row.append(face)
+        rows.append(row)
+    return rows
+
+
+# 28 x 11: brick_w + 1 by BRICK_H + 1 on the 240-pixel-wide screen
+BEVELS = {
+    "brick_green": (bevel(28, 11, GREEN, LIGHT_GREEN, DARK_GREEN), ("rle",)),
+    "brick_yellow": (bevel(28, 11, YELLOW, 0x80FFFF, 0x00A0A0), ("rle",)),
+}
+
+# Rotated copies: name -> (source, options)
+ROTATED = {
+    "bird_cw": ("bird", ("cw",)),
+}
+
+
+def to_index(c):
+    """0xBBGGRR -> GUICC_565 index."""
+    r, g, b = c & 0xFF, (c >> 8) & 0xFF, (c >> 16) & 0xFF
+    return ((b >> 3) << 11) | ((g >> 2) << 5) | (r >> 3)
+
+
+def from_art(art, pal):
+    w = len(art[0])
+    rows = []
+    for line in art:
+        if len(line) != w:
+            sys.exit("art rows differ in width: %r" % line)
+        rows.append([None if ch == "." else pal[ch] for ch in line])
+    return rows
+
+
+def read_ppm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    fields, pos = [], 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b"P6" or fields[3] != b"255":
+        sys.exit("%s: need a binary PPM (P6) with maxval 255" % path)
+    w, h = int(fields[1]), int(fields[2])
+    pix = data[pos + 1:]
+    rows = []
+    for y in range(h):
+        row = []
+        for x in range(w):
+            r, g, b = pix[3 * (y * w + x):3 * (y * w + x) + 3]
+            c = (b << 16) | (g << 8) | r
+            row.append(None if c == MAGENTA else c)
+        rows.append(row)
+    return rows
+
+
+def rotate_cw(rows):
+    h = len(rows)
+    return [[rows[h - 1 - c][r] for c in range(h)] for r in range(len(rows[0]))]
+
+
+def emit(name, rows, opts):
+    if "cw" in opts:
+        rows = rotate_cw(rows)
+    h, w = len(rows), len(rows[0])
+    pixels = [None if c is None else to_index(c) for row in rows for c in row]
+
+    flags, key = [], 0
+    if None in pixels:
+        used = set(pixels)
+        key = next(k for k in [to_index(MAGENTA)] + list(range(0x10000)) if k not in used)
+        pixels = [key if p is None else p for p in pixels]
+        flags.append("SPRITE_KEYED")
+
+    if "rle" in opts:
+        data, i = [], 0
+        while i < len(pixels):
+            n = 1
+            while i + n < len(pixels) and pixels[i + n] == pixels[i] and n < 0xFFFF:
+                n += 1
+            data += [n, pixels[i]]
+            i += n
+        flags.insert(0, "SPRITE_RLE")
+    else:
+        data = pixels
+
+    print("static const uint16_t spr_%s_data[%d] = {" % (name, len(data)))
+    for i in range(0, len(data), 12):
+        print("    " + ", ".join("0x%04X" % d for d in data[i:i + 12]) + ",")
+    print("};\n")
+    print("const Sprite_t spr_%s = { %d, %d, %s, 0x%04X, spr_%s_data, %d };\n"
+          % (name, w, h, " | ".join(flags) or "0", key, name, len(data)))
+
+
+def main(argv):
+    images = {name: (from_art(art, pal), opts) for name, (art, pal, opts) in SPRITES.items()}
+    images.update(BEVELS)
+    for name, (src, opts) in ROTATED.items():
+        images[name] = (images[src][0], opts)
+    for arg in argv:
+        if "=" not in arg:
+            continue
+        name, spec = arg.split("=", 1)
+        path, *opts = spec.split(",")
+        images[name] = (read_ppm(path), tuple(opts))
+
+    print("/* Generated by tools/sprites.py, do not edit */")
+    print('#include "sprite.h"\n')
+    for name, (rows, opts) in images.items():
+        emit(name, rows, opts)
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
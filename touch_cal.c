@@ -0,0 +1,146 @@
+#include "touch_cal.h"
+#include "input.h"
+#include "GUI.h"
+#include "cmsis_os2.h"
+
+/* =========================================================================
+   CONFIGURATION
+   ========================================================================= */
+#define CAL_CROSS_SIZE     10
+#define CAL_MIN_SAMPLES    4       // Readings averaged per target
+#define CAL_POLL_MS        10
+
+// Reference targets: spread out and not on one line
+static const int16_t cal_targets[3][2] = {
+    { 24,  32},
+    {216, 160},
+    {120, 296}
+};
+
+/* =========================================================================
+   HELPERS
+   ========================================================================= */
+static void DrawCross(int16_t x, int16_t y, GUI_COLOR color) {
+    GUI_SetColor(color);
+    GUI_DrawHLine(y, x - CAL_CROSS_SIZE, x + CAL_CROSS_SIZE);
+    GUI_DrawVLine(x, y - CAL_CROSS_SIZE, y + CAL_CROSS_SIZE);
+    GUI_DrawCircle(x, y, CAL_CROSS_SIZE / 2);
+}
+
+static void DrawPrompt(const char *line1, const char *line2) {
+    GUI_SetBkColor(GUI_BLACK);
+    GUI_Clear();
+    GUI_SetColor(GUI_WHITE);
+    GUI_SetFont(GUI_FONT_16_ASCII);
+    GUI_DispStringHCenterAt(line1, 120, 200);
+    GUI_DispStringHCenterAt(line2, 120, 220);
+}
+
+/*
+ * Average the raw readings of one press on a target.
+ * Returns 0 on success, -1 if '#' was pressed.
+ */
+static int CollectPoint(uint16_t raw[2]) {
+    Touch_Event_t ev[8];
+
+    while (1) {
+        uint32_t sx = 0, sy = 0, cnt = 0;
+        int      down = 0, up = 0;
+
+        // Wait for a new press
+        while (!down) {
+            if (Keypad_Get_Key() == '#') return -1;
+            int n = Touch_PollEvents(ev, 8);
+            for (int i = 0; i < n; i++) {
+                if (ev[i].type == TOUCH_EVT_DOWN) down = 1;
+            }
+            osDelay(CAL_POLL_MS);
+        }
+
+        // Accumulate until release
+        while (!up) {
+            uint16_t rx, ry;
+
+            if (Touch_GetRaw(&rx, &ry)) {
+                sx += rx;
+                sy += ry;
+                cnt++;
+            }
+            int n = Touch_PollEvents(ev, 8);
+            for (int i = 0; i < n; i++) {
+                if (ev[i].type == TOUCH_EVT_UP) up = 1;
+            }
+            osDelay(CAL_POLL_MS);
+        }
+
+        if (cnt >= CAL_MIN_SAMPLES) {
+            raw[0] = (uint16_t)(sx / cnt);
+            raw[1] = (uint16_t)(sy / cnt);
+            return 0;
+        }
+        // Too short a tap to trust: ask again
+    }
+}
+
+/* =========================================================================
+   CALIBRATION SCREEN
+   ========================================================================= */
+void StartTouchCalibration(void) {
+    uint16_t    raw[3][2];
+    Touch_Cal_t cal, prev;
+
+    Touch_GetCalibration(&prev);
+    Touch_FlushEvents();
+
+    for (int i = 0; i < 3; i++) {
+        DrawPrompt("Touch and hold the cross", "Press '#' to Exit");
+        DrawCross(cal_targets[i][0], cal_targets[i][1], GUI_YELLOW);
+
+        if (CollectPoint(raw[i]) != 0) return;
+
+        DrawCross(cal_targets[i][0], cal_targets[i][1], GUI_GREEN);
+        osDelay(200);
+    }
+
+    if (Touch_SolveCalibration(cal_targets, raw, &cal) != 0) {
+        DrawPrompt("Calibration failed", "Points too close");
+        osDelay(1500);
+        return;
+    }
+    Touch_SetCalibration(&cal);
+
+    /* --- Verify: draw where touches land, '5' saves, '#' discards --- */
+    DrawPrompt("Touch to test", "5: Save   #: Discard");
+    Touch_FlushEvents();
+
+    while (1) {
+        Touch_Event_t ev[8];
+        char key = Keypad_Get_Key();
+
+        int n = Touch_PollEvents(ev, 8);
+        for (int i = 0; i < n; i++) {
+            if (ev[i].type != TOUCH_EVT_UP) {
+                GUI_SetColor(GUI_RED);
+                GUI_FillCircle(ev[i].x, ev[i].y, 2);
+            }
+        }
+
+        if (key == '5') {
+            GUI_SetColor(GUI_WHITE);
+            GUI_SetFont(GUI_FONT_16_ASCII);
+            GUI_DispStringHCenterAt("Saving...", 120, 250);
+            // The sector erase stalls the CPU for about a second: keep the message up meanwhile
+            int saved = Touch_SaveCalibration();
+            GUI_ClearRect(0, 250, 239, 270);
+            GUI_DispStringHCenterAt((saved == 0) ? "Saved" : "Save failed", 120, 250);
+            osDelay(1000);
+            return;
+        }
+        if (key == '#') {
+            // Back to whatever was active before this screen
+            Touch_SetCalibration(&prev);
+            return;
+        }
+        osDelay(CAL_POLL_MS);
+    }
+}
@@ -0,0 +1,6 @@
+#ifndef TOUCH_CAL_H
+#define TOUCH_CAL_H
+
+void StartTouchCalibration(void);
+
+#endif